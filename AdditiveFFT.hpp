@@ -0,0 +1,230 @@
+#ifndef ADDITIVE_FFT_HPP
+#define ADDITIVE_FFT_HPP
+
+#include "GaloisField.hpp"
+
+/**
+ * Additive FFT over GF(2^m) in the Lin-Chung-Han novel polynomial basis
+ *
+ * The evaluation points are the subspace spanned by the first bits of the element representation: a transform
+ * of size 2^L evaluates at the elements shift ^ l, l < 2^L, for any shift whose low L bits are zero. With the
+ * subspace polynomials s_k(x) = prod over a < 2^k of (x - a), normalized as S_k = s_k / s_k(2^k), the novel
+ * basis is X_j = the product of S_k over the set bits k of j, and a polynomial given by its 2^L coefficients
+ * in that basis is evaluated, or interpolated back, with L layers of 2^(L-1) butterflies: O(n log n)
+ * multiplications instead of the n^2 of evaluating point by point.
+ *
+ * toNovelBasis and fromNovelBasis convert from and to ordinary coefficients by dividing by the sparse s_k
+ * (they have k+1 terms), O(n log^2 n), so products and multipoint evaluation of ordinary polynomials work too;
+ * GFPoly uses it for large products. Written for GF(2^8), GF(2^16) and GF(2^32), any m <= 64 works.
+ */
+class AdditiveFFT {
+    private:
+        fieldArithmetic arithmetic;
+        int degree;
+        vector<vector<uint64_t>> skew;       // skew[k][i] = S_k(2^i), the butterfly constants come from these
+        vector<vector<uint64_t>> subspace;   // subspace[k][i] = coefficient of x^(2^i) in s_k, i <= k
+        vector<uint64_t> normalizer;         // s_k(2^k)
+        vector<uint64_t> normalizerInverse;
+
+        // S_k(beta), S_k being linear
+        uint64_t skewAt(int k, uint64_t beta) const {
+            uint64_t value = 0;
+            while (beta) {
+                value ^= skew[k][__builtin_ctzll(beta)];
+                beta &= beta - 1;
+            }
+            return value;
+        }
+
+        void checkSize(int logN, uint64_t shift) const {
+            if (logN < 0 || logN > degree || logN > 30) {
+                throw invalid_argument("transform size must be 2^L with L <= m");
+            }
+            if (logN < 64 && (shift & ((1ULL << logN) - 1))) {
+                throw invalid_argument("the shift of a size 2^L transform must have its low L bits zero");
+            }
+        }
+
+    public:
+        /**
+         * @param field Arithmetic of GF(2^m); transforms have up to 2^m points
+         */
+        AdditiveFFT(const fieldArithmetic &field) : arithmetic(field), degree(field.getDegree()) {
+            int m = degree;
+            // s_0(x) = x and s_(k+1)(x) = s_k(x) * (s_k(x) + s_k(2^k)) = s_k(x)^2 + s_k(2^k) s_k(x)
+            vector<uint64_t> values(m); // s_k(2^i)
+            for (int i=0; i<m; i++) {
+                values[i] = 1ULL << i;
+            }
+            vector<uint64_t> coefficients = {1};
+            for (int k=0; k<m; k++) {
+                uint64_t norm = values[k];
+                uint64_t inverse = arithmetic.inverse(norm);
+                normalizer.push_back(norm);
+                normalizerInverse.push_back(inverse);
+                subspace.push_back(coefficients);
+                skew.emplace_back(m, 0);
+                for (int i=0; i<m; i++) {
+                    skew[k][i] = arithmetic.multiply(values[i], inverse);
+                }
+
+                vector<uint64_t> next(k + 2, 0);
+                for (int i=0; i<=k; i++) {
+                    next[i+1] ^= arithmetic.square(coefficients[i]);
+                    next[i] ^= arithmetic.multiply(norm, coefficients[i]);
+                }
+                coefficients = next;
+                for (int i=0; i<m; i++) {
+                    values[i] = arithmetic.square(values[i]) ^ arithmetic.multiply(norm, values[i]);
+                }
+            }
+        }
+        AdditiveFFT(const GaloisField &field) : AdditiveFFT(field.getArithmetic()) {
+        }
+
+        const fieldArithmetic &getArithmetic() const {
+            return arithmetic;
+        }
+
+        /**
+         * Novel-basis coefficients to values: data[l] becomes D(shift ^ l) for l < 2^logN
+         *
+         * @param shift Picks the coset of the evaluation points; its low logN bits must be zero
+         */
+        void fft(uint64_t *data, int logN, uint64_t shift = 0) const {
+            checkSize(logN, shift);
+            // D = D0 + S_(k-1) D1 on a coset beta + span(1 .. 2^(k-1)): S_(k-1) is the constant c = S_(k-1)(beta)
+            // on the lower half of the points and c + 1 on the upper half
+            for (int k=logN; k>=1; k--) {
+                size_t half = (size_t)1 << (k - 1), block = 2 * half;
+                for (size_t start=0; start<((size_t)1 << logN); start+=block) {
+                    uint64_t c = skewAt(k - 1, shift ^ start);
+                    for (size_t i=start; i<start+half; i++) {
+                        if (c)
+                            data[i] ^= arithmetic.multiply(c, data[i + half]);
+                        data[i + half] ^= data[i];
+                    }
+                }
+            }
+        }
+
+        // Values at shift ^ l back to novel-basis coefficients, the butterflies of fft undone in reverse
+        void ifft(uint64_t *data, int logN, uint64_t shift = 0) const {
+            checkSize(logN, shift);
+            for (int k=1; k<=logN; k++) {
+                size_t half = (size_t)1 << (k - 1), block = 2 * half;
+                for (size_t start=0; start<((size_t)1 << logN); start+=block) {
+                    uint64_t c = skewAt(k - 1, shift ^ start);
+                    for (size_t i=start; i<start+half; i++) {
+                        data[i + half] ^= data[i];
+                        if (c)
+                            data[i] ^= arithmetic.multiply(c, data[i + half]);
+                    }
+                }
+            }
+        }
+
+        /*
+            Ordinary coefficients p[0, 2^logN) to novel-basis coefficients. Since X_(j + 2^k) = S_k X_j for
+            j < 2^k, dividing a block of 2^(k+1) coefficients by S_k leaves the remainder in the lower half and
+            the quotient in the upper, each then converted a level down. s_k is monic with k+1 terms, so the
+            division is done by s_k in place and the quotient scaled by s_k(2^k).
+        */
+        void toNovelBasis(uint64_t *p, int logN) const {
+            checkSize(logN, 0);
+            for (int k=logN-1; k>=0; k--) {
+                size_t half = (size_t)1 << k, block = 2 * half;
+                const vector<uint64_t> &s = subspace[k];
+                for (size_t start=0; start<((size_t)1 << logN); start+=block) {
+                    uint64_t *b = p + start;
+                    for (size_t j=block-1; j>=half; j--) {
+                        uint64_t q = b[j];
+                        if (q) {
+                            for (int i=0; i<k; i++) {
+                                b[j - half + ((size_t)1 << i)] ^= arithmetic.multiply(q, s[i]);
+                            }
+                        }
+                    }
+                    for (size_t j=half; j<block; j++) {
+                        b[j] = arithmetic.multiply(b[j], normalizer[k]);
+                    }
+                }
+            }
+        }
+
+        // The inverse of toNovelBasis: each quotient multiplied back by s_k, lowest level first
+        void fromNovelBasis(uint64_t *p, int logN) const {
+            checkSize(logN, 0);
+            for (int k=0; k<logN; k++) {
+                size_t half = (size_t)1 << k, block = 2 * half;
+                const vector<uint64_t> &s = subspace[k];
+                for (size_t start=0; start<((size_t)1 << logN); start+=block) {
+                    uint64_t *b = p + start;
+                    for (size_t j=half; j<block; j++) {
+                        b[j] = arithmetic.multiply(b[j], normalizerInverse[k]);
+                    }
+                    for (size_t j=half; j<block; j++) {
+                        uint64_t q = b[j];
+                        if (q) {
+                            for (int i=0; i<k; i++) {
+                                b[j - half + ((size_t)1 << i)] ^= arithmetic.multiply(q, s[i]);
+                            }
+                        }
+                    }
+                }
+            }
+        }
+
+        /**
+         * Values of the ordinary polynomial with coefficients p (at most 2^logN of them) at shift ^ l, l < 2^logN
+         */
+        vector<uint64_t> evaluate(const vector<uint64_t> &p, int logN, uint64_t shift = 0) const {
+            checkSize(logN, shift);
+            size_t n = (size_t)1 << logN;
+            if (p.size() > n) {
+                throw invalid_argument("more coefficients than evaluation points");
+            }
+            vector<uint64_t> values(p);
+            values.resize(n, 0);
+            toNovelBasis(values.data(), logN);
+            fft(values.data(), logN, shift);
+            return values;
+        }
+
+        // Ordinary coefficients of the polynomial of degree < values.size() (a power of 2) taking values[l] at shift ^ l
+        vector<uint64_t> interpolate(vector<uint64_t> values, uint64_t shift = 0) const {
+            int logN = 0;
+            while (((size_t)1 << logN) < values.size())
+                logN++;
+            if (((size_t)1 << logN) != values.size()) {
+                throw invalid_argument("interpolation needs a power of 2 of values");
+            }
+            ifft(values.data(), logN, shift);
+            fromNovelBasis(values.data(), logN);
+            return values;
+        }
+
+        /**
+         * Product of two ordinary polynomials by evaluating both at 2^L >= deg(a*b) + 1 points
+         *
+         * @throws invalid_argument if the product has more than 2^m coefficients
+         */
+        vector<uint64_t> multiply(const vector<uint64_t> &a, const vector<uint64_t> &b) const {
+            if (a.empty() || b.empty()) {
+                return {};
+            }
+            size_t length = a.size() + b.size() - 1;
+            int logN = 0;
+            while (((size_t)1 << logN) < length)
+                logN++;
+            vector<uint64_t> va = evaluate(a, logN), vb = evaluate(b, logN);
+            for (size_t i=0; i<va.size(); i++) {
+                va[i] = arithmetic.multiply(va[i], vb[i]);
+            }
+            vector<uint64_t> product = interpolate(move(va));
+            product.resize(length);
+            return product;
+        }
+};
+
+#endif // ADDITIVE_FFT_HPP
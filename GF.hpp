@@ -0,0 +1,346 @@
+#ifndef GF_HPP
+#define GF_HPP
+
+#include <array>
+#include <utility>
+#include "GaloisField.hpp"
+
+/*
+    Compile-time kernels behind GF<M, Poly>. They live outside GF because the constexpr tables have to be
+    built from functions of an already complete class.
+*/
+template <unsigned M, uint64_t Poly>
+struct GFKernels {
+    static_assert(M >= 1 && M <= 64, "GF<M, Poly> supports 1 <= M <= 64");
+
+    typedef elementWord<M> word;
+
+    static constexpr uint64_t mask = (M >= 64) ? ~0ULL : ((1ULL << M) - 1);
+    static constexpr uint64_t reduction = Poly & mask; // defining polynomial minus x^M
+    static constexpr uint64_t order = mask; // 2^M - 1
+    static constexpr bool hasTables = (M <= fieldTables::maxDegree);
+
+    // Table sizes are 1 when M > 16 so the tables still have a type
+    static constexpr size_t tableSize = hasTables ? ((size_t)1 << M) : 1;
+
+    struct tableSet {
+        uint64_t generator = 0;
+        array<word, tableSize> exp{};     // exp[i] = generator^i, 0 <= i < 2^M-1
+        array<word, tableSize> log{};     // log[generator^i] = i
+        array<word, tableSize> inverse{}; // inverse[0] = 0
+    };
+
+    // a*x mod p(x), branch free
+    static constexpr uint64_t timesX(uint64_t a) {
+        return ((a << 1) & mask) ^ (reduction & (0 - ((a >> (M - 1)) & 1)));
+    }
+
+    // Shift-and-add product with the M steps expanded by a fold expression
+    template <size_t... I>
+    static constexpr uint64_t unrolledMultiply(uint64_t a, uint64_t b, index_sequence<I...>) {
+        uint64_t product = 0;
+        ((void)(product ^= a & (0 - ((b >> I) & 1)), a = timesX(a)), ...);
+        return product;
+    }
+
+    // As above with a constant multiplier; the terms for zero bits of C drop out at compile time
+    template <uint64_t C, size_t... I>
+    static constexpr uint64_t unrolledMultiplyBy(uint64_t a, index_sequence<I...>) {
+        uint64_t product = 0;
+        ((void)(product ^= ((C >> I) & 1) ? a : 0, a = timesX(a)), ...);
+        return product;
+    }
+
+    static constexpr uint64_t multiply(uint64_t a, uint64_t b) {
+        return unrolledMultiply(a, b, make_index_sequence<M>());
+    }
+
+    // a*b stepping only through the bits of b, cheap when b is small (generators usually are 2 or 3)
+    static constexpr uint64_t multiplySmall(uint64_t a, uint64_t b) {
+        uint64_t product = 0;
+        while (b) {
+            if (b & 1)
+                product ^= a;
+            a = timesX(a);
+            b >>= 1;
+        }
+        return product;
+    }
+
+    static constexpr uint64_t power(uint64_t a, uint64_t exponent) {
+        uint64_t result = 1;
+        while (exponent > 0) {
+            if (exponent & 1)
+                result = multiply(result, a);
+            a = multiply(a, a);
+            exponent >>= 1;
+        }
+        return result;
+    }
+
+    // Itoh-Tsujii: a^-1 = (a^(2^(M-1)-1))^2, see fieldArithmetic::inverseItohTsujii
+    static constexpr uint64_t inverse(uint64_t a) {
+        if (a == 0 || M == 1) {
+            return a;
+        }
+        unsigned n = M - 1;
+        int top = 31;
+        while (!((n >> top) & 1))
+            top--;
+        uint64_t beta = a;
+        unsigned k = 1;
+        for (int i=top-1; i>=0; i--) {
+            uint64_t frobenius = beta;
+            for (unsigned j=0; j<k; j++)
+                frobenius = multiply(frobenius, frobenius);
+            beta = multiply(frobenius, beta);
+            k *= 2;
+            if ((n >> i) & 1) {
+                beta = multiply(multiply(beta, beta), a);
+                k++;
+            }
+        }
+        return multiply(beta, beta);
+    }
+
+    // GF(2)[x] helpers on single words for the irreducibility test; polyDegree(0) = -1
+    static constexpr int polyDegree(uint64_t a) {
+        return a ? 63 - __builtin_clzll(a) : -1;
+    }
+    static constexpr uint64_t polyMod(uint64_t a, uint64_t g) {
+        int dg = polyDegree(g);
+        while (polyDegree(a) >= dg)
+            a ^= g << (polyDegree(a) - dg);
+        return a;
+    }
+    // x^M + reduction mod g, for g of degree below M (x^M itself need not fit in a word)
+    static constexpr uint64_t modulusMod(uint64_t g) {
+        int dg = polyDegree(g);
+        uint64_t r = polyMod(1, g);
+        for (unsigned i=0; i<M; i++) {
+            r <<= 1;
+            if (polyDegree(r) >= dg)
+                r ^= g;
+        }
+        return r ^ polyMod(reduction, g);
+    }
+
+    /*
+        Rabin's test, as in polynomialIsIrreducible: x^(2^M) = x mod p, and gcd(x^(2^(M/q)) - x, p) = 1 for
+        each prime q dividing M. The Frobenius powers are squarings with the unrolled multiply mod p.
+    */
+    static constexpr bool isIrreducible() {
+        if (M == 1) {
+            return true;
+        }
+        uint64_t x = timesX(1);
+        uint64_t frobenius[M + 1] = {};
+        frobenius[0] = x;
+        for (unsigned k=1; k<=M; k++) {
+            frobenius[k] = multiply(frobenius[k-1], frobenius[k-1]);
+        }
+        if (frobenius[M] != x) {
+            return false;
+        }
+        unsigned n = M;
+        for (unsigned q=2; q<=n; q++) {
+            if (n % q != 0)
+                continue;
+            while (n % q == 0)
+                n /= q;
+            uint64_t g = frobenius[M / q] ^ x;
+            if (g == 0) {
+                return false;
+            }
+            uint64_t a = g, b = modulusMod(g);
+            while (b) {
+                uint64_t r = polyMod(a, b);
+                a = b;
+                b = r;
+            }
+            if (polyDegree(a) > 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // Same generator search as fieldArithmetic: g generates iff g^((2^M-1)/p) != 1 for each prime p | 2^M-1
+    static constexpr tableSet buildTables() {
+        tableSet t{};
+        if (!hasTables) {
+            return t;
+        }
+        uint64_t primeFactors[16] = {};
+        int factorCount = 0;
+        uint64_t n = order;
+        for (uint64_t p=2; p*p<=n; p++) {
+            if (n % p == 0) {
+                primeFactors[factorCount++] = p;
+                while (n % p == 0)
+                    n /= p;
+            }
+        }
+        if (n > 1)
+            primeFactors[factorCount++] = n;
+
+        for (uint64_t g=1; g<=order; g++) {
+            if (power(g, order) != 1)
+                continue;
+            bool isGenerator = true;
+            for (int i=0; i<factorCount; i++) {
+                if (power(g, order / primeFactors[i]) == 1) {
+                    isGenerator = false;
+                    break;
+                }
+            }
+            if (!isGenerator)
+                continue;
+
+            t.generator = g;
+            uint64_t x = 1;
+            for (uint64_t i=0; i<order; i++) {
+                t.exp[i] = (word)x;
+                t.log[x] = (word)i;
+                x = multiplySmall(x, g);
+            }
+            for (uint64_t a=1; a<=order; a++) {
+                t.inverse[a] = t.exp[(order - t.log[a]) % order];
+            }
+            return t;
+        }
+        return t;
+    }
+};
+
+template <unsigned M, uint64_t Poly>
+inline constexpr typename GFKernels<M, Poly>::tableSet GFTables = GFKernels<M, Poly>::buildTables();
+
+
+/**
+ * Compile-time specialized GF(2^M)
+ *
+ * The counterpart of the runtime GaloisField for fields known at compile time. The defining polynomial is a
+ * template parameter (the x^M term may be included, as in GF<8, 0x11D>), reduction is unrolled over the M
+ * bits, and for M <= 16 the log/antilog/inverse tables are built constexpr, so there is no setup at startup.
+ * Everything is static; GF is never instantiated.
+ *
+ * The M = 16 tables are 384 KB of read-only data and take a few seconds of constexpr evaluation in each
+ * translation unit that uses them.
+ */
+template <unsigned M, uint64_t Poly>
+class GF {
+    private:
+        typedef GFKernels<M, Poly> kernels;
+        static constexpr uint64_t order = kernels::order;
+
+    public:
+        typedef elementWord<M> word;
+        typedef basicFieldElement<word> element;
+
+        static constexpr unsigned degree = M;
+        static constexpr uint64_t reduction = kernels::reduction;
+        static constexpr bool hasTables = kernels::hasTables;
+        static constexpr const typename kernels::tableSet &tables = GFTables<M, Poly>;
+        static_assert(kernels::isIrreducible(), "GF<M, Poly>: the defining polynomial is not irreducible");
+
+        // a*C for a compile-time constant C; folds to C's set bits worth of shifts and XORs
+        template <uint64_t C>
+        static constexpr word multiplyBy(word a) {
+            return (word)kernels::template unrolledMultiplyBy<C & kernels::mask>(a, make_index_sequence<M>());
+        }
+
+        static constexpr word add(word a, word b) {
+            return a ^ b;
+        }
+
+        static constexpr word multiply(word a, word b) {
+            if constexpr (hasTables) {
+                if (a == 0 || b == 0) {
+                    return 0;
+                }
+                uint64_t sum = (uint64_t)tables.log[a] + tables.log[b];
+                if (sum >= order) {
+                    sum -= order;
+                }
+                return tables.exp[sum];
+            } else {
+                return (word)kernels::multiply(a, b);
+            }
+        }
+
+        // The inverse of 0 is defined as 0
+        static constexpr word inverse(word a) {
+            if constexpr (hasTables) {
+                return tables.inverse[a];
+            } else {
+                return (word)kernels::inverse(a);
+            }
+        }
+
+        // Division by zero yields 0
+        static constexpr word divide(word a, word b) {
+            if constexpr (hasTables) {
+                if (a == 0 || b == 0) {
+                    return 0;
+                }
+                uint64_t diff = (uint64_t)tables.log[a] + order - tables.log[b];
+                if (diff >= order) {
+                    diff -= order;
+                }
+                return tables.exp[diff];
+            } else {
+                return multiply(a, inverse(b));
+            }
+        }
+
+        // Negative exponents are powers of the inverse
+        static constexpr word power(word a, long long exponent) {
+            uint64_t e = (uint64_t)exponent;
+            if (exponent < 0) {
+                a = inverse(a);
+                e = 0 - (uint64_t)exponent; // no overflow for LLONG_MIN
+            }
+            if constexpr (hasTables) {
+                if (e == 0) {
+                    return 1;
+                }
+                if (a == 0) {
+                    return 0;
+                }
+                return tables.exp[(uint64_t)tables.log[a] * (e % order) % order];
+            } else {
+                return (word)kernels::power(a, e);
+            }
+        }
+
+        // dst[i] = c * src[i] (or dst[i] ^= c * src[i]) for n bytes, with the fastest SIMD kernel available
+        template <bool Accumulate = false>
+        static void regionMultiply(const uint8_t *src, uint8_t *dst, size_t n, word c) {
+            static_assert(M <= 8, "byte region operations need M <= 8");
+            gf8Multiplier table = makeGf8Multiplier(c, M, [](word a, word b) { return multiply(a, b); });
+            regionMultiply8<Accumulate>(src, dst, n, table, bestRegionKernel());
+        }
+        static void regionMultiplyXor(const uint8_t *src, uint8_t *dst, size_t n, word c) {
+            regionMultiply<true>(src, dst, n, c);
+        }
+
+        static constexpr element multiply(element a, element b) {
+            return element(multiply(a.getValue(), b.getValue()));
+        }
+        static constexpr element divide(element a, element b) {
+            return element(divide(a.getValue(), b.getValue()));
+        }
+        static constexpr element inverse(element a) {
+            return element(inverse(a.getValue()));
+        }
+        static constexpr element power(element a, long long exponent) {
+            return element(power(a.getValue(), exponent));
+        }
+};
+
+// The fixed fields we ship
+typedef GF<8, 0x11D> GF256;       // x^8+x^4+x^3+x^2+1
+typedef GF<16, 0x1100B> GF65536;  // x^16+x^12+x^3+x+1
+
+#endif // GF_HPP
@@ -0,0 +1,298 @@
+#ifndef GF_POLY_HPP
+#define GF_POLY_HPP
+
+#include <utility>
+#include "GaloisField.hpp"
+#include "AdditiveFFT.hpp"
+
+/**
+ * Polynomial with coefficients in GF(2^m), m <= 64
+ *
+ * The base type for coding theory over a GaloisField (Reed-Solomon, BCH and Goppa codes). Coefficients are
+ * stored contiguously, coefficients[i] for x^i, without trailing zeros, so the zero polynomial is empty and
+ * has degree -1. All coefficient arithmetic goes through the field's fieldArithmetic, shared between the
+ * polynomials of one field; operands of a binary operation must be over the same field.
+ */
+class GFPoly {
+    private:
+        shared_ptr<const fieldArithmetic> arithmetic;
+        vector<uint64_t> coefficients;
+
+        void normalize() {
+            while (!coefficients.empty() && coefficients.back() == 0)
+                coefficients.pop_back();
+        }
+
+        // out[0, na+nb-1) ^= a*b, one coefficient product per pair
+        void multiplySchoolbook(const uint64_t *a, size_t na, const uint64_t *b, size_t nb, uint64_t *out) const {
+            for (size_t i=0; i<na; i++) {
+                if (a[i] == 0)
+                    continue;
+                for (size_t j=0; j<nb; j++) {
+                    out[i+j] ^= arithmetic->multiply(a[i], b[j]);
+                }
+            }
+        }
+
+        /*
+            out[0, 2n-1) ^= a*b for n coefficients each, Karatsuba as in clmulKaratsuba but over GF(2^m)
+            coefficients: three half-size products instead of four, the additions being XORs. scratch holds
+            karatsubaScratchWords(n) words.
+        */
+        void multiplyKaratsuba(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out, uint64_t *scratch) const {
+            if (n < karatsubaThreshold) {
+                multiplySchoolbook(a, n, b, n, out);
+                return;
+            }
+            size_t half = (n + 1) / 2, high = n - half;
+            uint64_t *aSum = scratch, *bSum = scratch + half, *middle = scratch + 2*half, *rest = scratch + 4*half;
+            for (size_t i=0; i<half; i++) {
+                aSum[i] = a[i] ^ ((i < high) ? a[half+i] : 0);
+                bSum[i] = b[i] ^ ((i < high) ? b[half+i] : 0);
+            }
+            // middle = (a0+a1)(b0+b1) + a0*b0 + a1*b1, then every piece is added in at its offset
+            fill(middle, middle + 2*half - 1, 0);
+            multiplyKaratsuba(aSum, bSum, half, middle, rest);
+            fill(aSum, aSum + 2*half, 0); // aSum and bSum become a0*b0
+            multiplyKaratsuba(a, b, half, aSum, rest);
+            for (size_t i=0; i<2*half-1; i++) {
+                middle[i] ^= aSum[i];
+                out[i] ^= aSum[i];
+            }
+            fill(aSum, aSum + 2*half, 0); // and then a1*b1
+            multiplyKaratsuba(a + half, b + half, high, aSum, rest);
+            for (size_t i=0; i+1<2*high; i++) {
+                middle[i] ^= aSum[i];
+                out[2*half+i] ^= aSum[i];
+            }
+            for (size_t i=0; i<2*half-1; i++) {
+                out[half+i] ^= middle[i];
+            }
+        }
+
+        static size_t karatsubaScratchWords(size_t n) {
+            size_t words = 0;
+            while (n >= karatsubaThreshold) {
+                size_t half = (n + 1) / 2;
+                words += 4 * half;
+                n = half;
+            }
+            return words;
+        }
+
+    public:
+        // Below this many coefficients a product is schoolbook (measured: 8 to 16 is best for m = 8 to 64)
+        static constexpr size_t karatsubaThreshold = 16;
+        // From this many coefficients in the shorter operand a product goes through AdditiveFFT, when the field has
+        // enough points for it (measured at m = 16: 2048 coefficients take 2/3 of the time of Karatsuba, 8192 half)
+        static constexpr size_t fftThreshold = 2048;
+
+        /**
+         * @param field Field of the coefficients
+         * @param coefficients coefficients[i] is the coefficient of x^i
+         */
+        GFPoly(const GaloisField &field, vector<uint64_t> coefficients = {})
+            : arithmetic(make_shared<fieldArithmetic>(field.getArithmetic())), coefficients(move(coefficients)) {
+            normalize();
+        }
+        GFPoly(shared_ptr<const fieldArithmetic> arithmetic, vector<uint64_t> coefficients = {})
+            : arithmetic(move(arithmetic)), coefficients(move(coefficients)) {
+            normalize();
+        }
+
+        // x^k times c, e.g. the monomial x when k = 1 and c = 1
+        GFPoly monomial(size_t k, uint64_t c = 1) const {
+            vector<uint64_t> p(k + 1, 0);
+            p[k] = c;
+            return GFPoly(arithmetic, move(p));
+        }
+        GFPoly constant(uint64_t c) const {
+            return GFPoly(arithmetic, {c});
+        }
+
+        const shared_ptr<const fieldArithmetic> &getArithmetic() const {
+            return arithmetic;
+        }
+        const vector<uint64_t> &getCoefficients() const {
+            return coefficients;
+        }
+        // -1 for the zero polynomial
+        long degree() const {
+            return (long)coefficients.size() - 1;
+        }
+        bool isZero() const {
+            return coefficients.empty();
+        }
+        // The coefficient of x^i, 0 past the degree
+        uint64_t operator [] (size_t i) const {
+            return (i < coefficients.size()) ? coefficients[i] : 0;
+        }
+        uint64_t leadingCoefficient() const {
+            return coefficients.empty() ? 0 : coefficients.back();
+        }
+        bool operator == (const GFPoly &other) const {
+            return coefficients == other.coefficients;
+        }
+        bool operator != (const GFPoly &other) const {
+            return coefficients != other.coefficients;
+        }
+
+        // Addition and subtraction are both coefficient-wise XOR
+        GFPoly operator + (const GFPoly &other) const {
+            vector<uint64_t> sum(max(coefficients.size(), other.coefficients.size()), 0);
+            for (size_t i=0; i<coefficients.size(); i++)
+                sum[i] = coefficients[i];
+            for (size_t i=0; i<other.coefficients.size(); i++)
+                sum[i] ^= other.coefficients[i];
+            return GFPoly(arithmetic, move(sum));
+        }
+        GFPoly operator - (const GFPoly &other) const {
+            return *this + other;
+        }
+
+        GFPoly scale(uint64_t c) const {
+            vector<uint64_t> scaled(coefficients.size());
+            for (size_t i=0; i<coefficients.size(); i++) {
+                scaled[i] = arithmetic->multiply(coefficients[i], c);
+            }
+            return GFPoly(arithmetic, move(scaled));
+        }
+
+        // Scaled so the leading coefficient is 1 (the zero polynomial stays zero)
+        GFPoly monic() const {
+            return isZero() ? *this : scale(arithmetic->inverse(leadingCoefficient()));
+        }
+
+        /*
+            Schoolbook below karatsubaThreshold coefficients, Karatsuba above; the longer operand is cut into
+            pieces the length of the shorter so each Karatsuba product is balanced. Past fftThreshold, evaluation
+            and interpolation by the additive FFT, O(n log^2 n), when the product fits in 2^m points.
+        */
+        GFPoly operator * (const GFPoly &other) const {
+            if (isZero() || other.isZero()) {
+                return GFPoly(arithmetic);
+            }
+            const vector<uint64_t> &longer = (coefficients.size() >= other.coefficients.size()) ? coefficients : other.coefficients;
+            const vector<uint64_t> &shorter = (coefficients.size() >= other.coefficients.size()) ? other.coefficients : coefficients;
+            size_t n = shorter.size();
+            vector<uint64_t> product(longer.size() + n - 1, 0);
+            int fftLog = min(arithmetic->getDegree(), 30);
+            if (n >= fftThreshold && product.size() <= ((size_t)1 << fftLog)) {
+                return GFPoly(arithmetic, AdditiveFFT(*arithmetic).multiply(longer, shorter));
+            }
+            if (n < karatsubaThreshold) {
+                multiplySchoolbook(longer.data(), longer.size(), shorter.data(), n, product.data());
+                return GFPoly(arithmetic, move(product));
+            }
+            vector<uint64_t> piece(n), pieceProduct(2*n - 1), scratch(karatsubaScratchWords(n));
+            for (size_t start=0; start<longer.size(); start+=n) {
+                for (size_t i=0; i<n; i++) {
+                    piece[i] = (start + i < longer.size()) ? longer[start+i] : 0;
+                }
+                fill(pieceProduct.begin(), pieceProduct.end(), 0);
+                multiplyKaratsuba(piece.data(), shorter.data(), n, pieceProduct.data(), scratch.data());
+                for (size_t i=0; i<pieceProduct.size() && start+i<product.size(); i++) {
+                    product[start+i] ^= pieceProduct[i];
+                }
+            }
+            return GFPoly(arithmetic, move(product));
+        }
+
+        /**
+         * Quotient and remainder: *this = quotient*divisor + remainder with deg remainder < deg divisor
+         *
+         * One inversion of the divisor's leading coefficient, then a multiply-accumulate of the divisor per
+         * quotient coefficient.
+         * @throws invalid_argument if divisor is zero
+         */
+        pair<GFPoly, GFPoly> divmod(const GFPoly &divisor) const {
+            if (divisor.isZero()) {
+                throw invalid_argument("division by the zero polynomial");
+            }
+            if (degree() < divisor.degree()) {
+                return {GFPoly(arithmetic), *this};
+            }
+            const vector<uint64_t> &d = divisor.coefficients;
+            size_t dn = d.size();
+            uint64_t leadInverse = arithmetic->inverse(d.back());
+            vector<uint64_t> remainder = coefficients;
+            vector<uint64_t> quotient(remainder.size() - dn + 1, 0);
+            for (size_t i=quotient.size(); i-- > 0; ) {
+                uint64_t q = arithmetic->multiply(remainder[i + dn - 1], leadInverse);
+                quotient[i] = q;
+                if (q == 0)
+                    continue;
+                for (size_t j=0; j<dn; j++) {
+                    remainder[i+j] ^= arithmetic->multiply(q, d[j]);
+                }
+            }
+            remainder.resize(dn - 1);
+            return {GFPoly(arithmetic, move(quotient)), GFPoly(arithmetic, move(remainder))};
+        }
+        GFPoly operator / (const GFPoly &divisor) const {
+            return divmod(divisor).first;
+        }
+        GFPoly operator % (const GFPoly &divisor) const {
+            return divmod(divisor).second;
+        }
+
+        // Monic greatest common divisor by Euclid's algorithm; gcd(0, 0) = 0
+        static GFPoly gcd(GFPoly a, GFPoly b) {
+            while (!b.isZero()) {
+                GFPoly r = a % b;
+                a = move(b);
+                b = move(r);
+            }
+            return a.monic();
+        }
+
+        // p(x) by Horner's rule
+        uint64_t evaluate(uint64_t x) const {
+            uint64_t value = 0;
+            for (size_t i=coefficients.size(); i-- > 0; ) {
+                value = arithmetic->multiply(value, x) ^ coefficients[i];
+            }
+            return value;
+        }
+
+        // Formal derivative: i*a_i is a_i for odd i and 0 for even i in characteristic 2
+        GFPoly derivative() const {
+            vector<uint64_t> d(coefficients.size() > 1 ? coefficients.size() - 1 : 0, 0);
+            for (size_t i=1; i<coefficients.size(); i+=2) {
+                d[i-1] = coefficients[i];
+            }
+            return GFPoly(arithmetic, move(d));
+        }
+
+        // p(inner(x)) by Horner's rule over polynomials
+        GFPoly compose(const GFPoly &inner) const {
+            GFPoly result(arithmetic);
+            for (size_t i=coefficients.size(); i-- > 0; ) {
+                result = result * inner + constant(coefficients[i]);
+            }
+            return result;
+        }
+
+        // e.g. 3x^2 + 1, coefficients in decimal
+        string toString() const {
+            if (isZero()) {
+                return "0";
+            }
+            string s;
+            for (size_t i=coefficients.size(); i-- > 0; ) {
+                if (coefficients[i] == 0)
+                    continue;
+                if (!s.empty())
+                    s += " + ";
+                if (coefficients[i] != 1 || i == 0)
+                    s += to_string(coefficients[i]);
+                if (i >= 1)
+                    s += "x";
+                if (i >= 2)
+                    s += "^" + to_string(i);
+            }
+            return s;
+        }
+};
+
+#endif // GF_POLY_HPP
@@ -0,0 +1,1491 @@
+#ifndef GALOIS_FIELD_HPP
+#define GALOIS_FIELD_HPP
+
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <cmath>
+#include <type_traits>
+#include <stdexcept>
+#include "carrylessMultiply.hpp"
+#include "binaryPolynomial.hpp"
+#include "polynomialSearch.hpp"
+#include "regionMultiply.hpp"
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <memory>
+#include <cstdint>
+#include <thread>
+using namespace std;
+
+
+/**
+ * Log/antilog tables for GF(2^m)
+ *
+ * Built once per field by GaloisField and shared by all of its elements. With a generator g,
+ * exp[i] = g^i for 0 <= i < 2^m-1 and log[g^i] = i, so a product is two loads and an add modulo 2^m-1.
+ * Only built for m <= 16 and only when a generator exists (i.e. the defining polynomial is irreducible).
+ */
+struct fieldTables {
+    static const int maxDegree = 16;
+    uint32_t order; // 2^m - 1, the size of the multiplicative group
+    uint32_t generator;
+    vector<uint16_t> exp; // exp[i] = generator^i
+    vector<uint16_t> log; // log[generator^i] = i, log[0] is unused
+
+    uint32_t multiply(uint32_t a, uint32_t b) const {
+        if (a == 0 || b == 0) {
+            return 0;
+        }
+        uint32_t sum = log[a] + log[b];
+        if (sum >= order) {
+            sum -= order;
+        }
+        return exp[sum];
+    }
+
+    // Division by zero yields 0, matching the 0 entry of the inverse table it replaces
+    uint32_t divide(uint32_t a, uint32_t b) const {
+        if (a == 0 || b == 0) {
+            return 0;
+        }
+        uint32_t diff = log[a] + order - log[b];
+        if (diff >= order) {
+            diff -= order;
+        }
+        return exp[diff];
+    }
+
+    uint32_t inverse(uint32_t a) const {
+        if (a == 0) {
+            return 0;
+        }
+        return exp[(order - log[a]) % order];
+    }
+
+    uint32_t power(uint32_t a, long long exponent) const {
+        if (exponent == 0) {
+            return 1;
+        }
+        if (a == 0) {
+            return 0;
+        }
+        long long e = ((long long)log[a] * (exponent % (long long)order)) % (long long)order;
+        if (e < 0) {
+            e += order;
+        }
+        return exp[e];
+    }
+};
+
+
+/**
+ * A GF(2)-linear map on GF(2^m) elements, such as the Frobenius power a -> a^(2^k), as one table per byte
+ *
+ * The image of a is the XOR of table[j][byte j of a] over the ceil(m/8) bytes, so applying any such map,
+ * however many squarings it stands for, costs m/8 loads. 2 KB per byte of m.
+ */
+struct linearMapTables {
+    int bytes = 0;
+    vector<uint64_t> table; // table[256*j + v] = image of v * x^(8j)
+
+    linearMapTables() {
+    }
+
+    /**
+     * @param m Degree of the field
+     * @param image Function giving the image of the basis element x^i, 0 <= i < m
+     */
+    template <typename Image>
+    linearMapTables(int m, Image image) : bytes((m + 7) / 8), table(256 * bytes, 0) {
+        uint64_t basis[64] = {};
+        for (int i=0; i<m; i++) {
+            basis[i] = image(i);
+        }
+        for (int j=0; j<bytes; j++) {
+            uint64_t *t = &table[256 * j];
+            for (int v=1; v<256; v++) {
+                // Each entry is a smaller entry plus the image of its lowest set bit
+                t[v] = t[v & (v - 1)] ^ basis[8*j + __builtin_ctz(v)];
+            }
+        }
+    }
+
+    uint64_t apply(uint64_t a) const {
+        uint64_t result = 0;
+        for (int j=0; j<bytes; j++) {
+            result ^= table[256 * j + ((a >> (8 * j)) & 0xFF)];
+        }
+        return result;
+    }
+};
+
+
+enum class multiplyMethod {
+    table,         // log/antilog lookup, m <= 16 with a generator
+    clmulHardware, // PCLMULQDQ product, Barrett reduction
+    clmulPortable, // 4-bit windowed carry-less product, Barrett reduction
+    shiftAndAdd    // bit-serial reference
+};
+
+// How the clmul products are reduced modulo the defining polynomial
+enum class reductionMethod {
+    barrett,     // two further carry-less products, any modulus
+    trinomial,   // shift-and-XOR folding for x^m + x^a + 1, a <= m/2
+    pentanomial  // the same for x^m + x^a + x^b + x^c + 1, a <= m/2
+};
+
+enum class inversionMethod {
+    table,      // log/antilog lookup, m <= 16 with a generator
+    itohTsujii, // a^-1 = (a^(2^(m-1)-1))^2 via a Frobenius addition chain
+    euclid      // extended Euclidean algorithm over GF(2)[x]
+};
+
+/**
+ * Word-level arithmetic engine for GF(2^m), m <= 64
+ *
+ * Values are the m-bit polynomial representations packed into a uint64_t. The defining polynomial is held
+ * without its x^m term (the same truncation fieldElement has always applied), so m = 64 fits in one word.
+ * Built once by GaloisField and shared by its elements.
+ */
+class fieldArithmetic {
+    private:
+        int degree;
+        uint64_t mask;       // low m bits set
+        uint64_t reduction;  // defining polynomial minus x^m
+        uint64_t topBit;     // x^(m-1)
+        uint64_t barrettMu;  // floor(x^2m / f) minus its x^m term
+        shared_ptr<const fieldTables> tables;
+        multiplyMethod multiplier;
+        inversionMethod inverter;
+        bool primitive;      // x generates the multiplicative group
+        reductionMethod reducer;
+        reductionMethod modulusShape;  // the sparse method the modulus allows, barrett if none
+        int sparseTerms[3] = {0, 0, 0}; // middle exponents a, b, c of a trinomial or pentanomial modulus
+        uint64_t sqrtX;      // x^(2^(m-1)), the square root of x
+        // a -> a^(2^k) for the k the Itoh-Tsujii chain of m-1 uses, fields without tables only
+        shared_ptr<const vector<pair<int, linearMapTables>>> frobeniusMaps;
+        uint64_t traceMask;  // bit i is Tr(x^i), so Tr(a) is the parity of a & traceMask
+        // c -> z with z^2 + z = c for Tr(c) = 0: the half-trace for odd m, a solved basis for even m
+        shared_ptr<const linearMapTables> quadraticSolver;
+
+        /*
+            Find a generator g of the multiplicative group (g has order 2^m-1 iff g^((2^m-1)/p) != 1
+            for every prime p dividing 2^m-1) and fill exp/log by walking its powers.
+            If the defining polynomial is reducible no generator exists and the field is left without tables.
+        */
+        void defineFieldTables() {
+            if (degree < 1 || degree > fieldTables::maxDegree) {
+                return;
+            }
+            uint32_t order = (1u << degree) - 1;
+            vector<uint64_t> factors = primeFactors(order);
+
+            for (uint32_t g=1; g<=order; g++) {
+                if (shiftAndAddPower(g, order) != 1)
+                    continue;
+                bool isGenerator = true;
+                for (auto p: factors) {
+                    if (shiftAndAddPower(g, order / p) == 1) {
+                        isGenerator = false;
+                        break;
+                    }
+                }
+                if (!isGenerator)
+                    continue;
+
+                auto table = make_shared<fieldTables>();
+                table->order = order;
+                table->generator = g;
+                table->exp.resize(order);
+                table->log.assign(order + 1, 0);
+                uint32_t x = 1;
+                for (uint32_t i=0; i<order; i++) {
+                    table->exp[i] = x;
+                    table->log[x] = i;
+                    x = shiftAndAddMultiply(x, g);
+                }
+                tables = table;
+                return;
+            }
+        }
+
+        // The element x, which for m = 1 reduces to the constant term of f
+        uint64_t xElement() const {
+            return (degree == 1) ? reduction : 2;
+        }
+
+        // f is primitive iff x^((2^m-1)/p) != 1 for every prime p dividing 2^m-1 (f is already irreducible)
+        bool testPrimitive() const {
+            uint64_t order = mask;
+            if (order == 1) {
+                return xElement() == 1;
+            }
+            for (auto p: primeFactors(order)) {
+                if (power(xElement(), order / p) == 1) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /*
+            The Frobenius powers Itoh-Tsujii takes are beta^(2^k) for each k that is a leading part of the bits
+            of m-1 (1, 3, 7, 15, 31 for m = 64), so those maps are tabulated, at most log2(m) of them: 80 KB
+            at m = 64
+        */
+        void defineFrobeniusMaps() {
+            auto maps = make_shared<vector<pair<int, linearMapTables>>>();
+            int n = degree - 1;
+            if (n >= 2) {
+                int top = 31 - __builtin_clz(n);
+                for (int i=top-1; i>=0; i--) {
+                    // k = 1 is a single square, cheaper than the table walk
+                    int k = n >> (i + 1);
+                    if (k > 1) {
+                        maps->push_back({k, frobeniusMap(k)});
+                    }
+                }
+            }
+            frobeniusMaps = maps;
+        }
+
+        /*
+            Tr(x^k) is the k-th power sum of the roots of f, so Newton's identities give it from the coefficients
+            alone: s_k = f_(m-1) s_(k-1) + ... + f_(m-k+1) s_1 + k f_(m-k), with s_0 = Tr(1) = m mod 2.
+        */
+        void defineTrace() {
+            auto coefficient = [this](int j) { return (j == degree) ? 1 : (int)((reduction >> j) & 1); };
+            vector<int> sums(degree);
+            sums[0] = degree & 1;
+            for (int k=1; k<degree; k++) {
+                int sum = (k & 1) ? coefficient(degree - k) : 0;
+                for (int j=1; j<k; j++) {
+                    sum ^= coefficient(degree - j) & sums[k - j];
+                }
+                sums[k] = sum;
+            }
+            traceMask = 0;
+            for (int k=0; k<degree; k++) {
+                traceMask |= (uint64_t)sums[k] << k;
+            }
+        }
+
+        /*
+            z^2 + z is linear with kernel {0, 1} and image the trace-0 elements. For odd m the half-trace
+            H(c) = c + c^4 + c^16 + ... + c^(4^((m-1)/2)) is a solution. For even m there is no such formula, so
+            the images z^2 + z of the basis are brought to reduced echelon form, keeping track of their preimages:
+            then each pivot bit of c selects one preimage. Either way the solver is a linear map, tabulated.
+        */
+        void defineQuadraticSolver() {
+            if (degree & 1) {
+                quadraticSolver = make_shared<linearMapTables>(degree, [this](int i) {
+                    uint64_t t = 1ULL << i, h = t;
+                    for (int j=0; j<(degree-1)/2; j++) {
+                        t = square(square(t));
+                        h ^= t;
+                    }
+                    return h;
+                });
+                return;
+            }
+            vector<uint64_t> images, preimages;
+            vector<int> pivots;
+            for (int i=0; i<degree; i++) {
+                uint64_t v = square(1ULL << i) ^ (1ULL << i), z = 1ULL << i;
+                for (size_t r=0; r<images.size(); r++) {
+                    if ((v >> pivots[r]) & 1) {
+                        v ^= images[r];
+                        z ^= preimages[r];
+                    }
+                }
+                if (v == 0) {
+                    continue; // z is in the kernel {0, 1}
+                }
+                int pivot = 63 - __builtin_clzll(v);
+                for (size_t r=0; r<images.size(); r++) {
+                    if ((images[r] >> pivot) & 1) {
+                        images[r] ^= v;
+                        preimages[r] ^= z;
+                    }
+                }
+                images.push_back(v);
+                preimages.push_back(z);
+                pivots.push_back(pivot);
+            }
+            quadraticSolver = make_shared<linearMapTables>(degree, [&](int i) {
+                for (size_t r=0; r<pivots.size(); r++) {
+                    if (pivots[r] == i)
+                        return preimages[r];
+                }
+                return (uint64_t)0;
+            });
+        }
+
+        // Product reduction by the method this field uses, for products built without a multiply
+        uint64_t reduceProduct(clmulProduct p) const {
+            switch (reducer) {
+                case reductionMethod::trinomial:
+                    return sparseReduce<1>(p, degree, mask, sparseTerms);
+                case reductionMethod::pentanomial:
+                    return sparseReduce<3>(p, degree, mask, sparseTerms);
+                default:
+                    return barrettReduce(p, degree, mask, reduction, barrettMu, clmulPortable);
+            }
+        }
+
+        uint64_t shiftAndAddPower(uint64_t a, uint64_t exponent) const {
+            uint64_t result = 1;
+            while (exponent > 0) {
+                if (exponent & 1)
+                    result = shiftAndAddMultiply(result, a);
+                a = shiftAndAddMultiply(a, a);
+                exponent >>= 1;
+            }
+            return result;
+        }
+
+    public:
+        /**
+         * @param m Degree of the field, 1 <= m <= 64
+         * @param poly Defining polynomial in decimal; the x^m term may be included (19 for x^4+x+1) or left implicit
+         * @param buildTables Build log/antilog tables when m <= 16
+         */
+        fieldArithmetic(int m, uint64_t poly, bool buildTables = true) {
+            if (m < 1 || m > 64) {
+                throw invalid_argument("GF(2^m) needs 1 <= m <= 64");
+            }
+            degree = m;
+            mask = (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+            reduction = poly & mask;
+            // x^m + reduction as a two-word polynomial
+            vector<uint64_t> f = {reduction | ((m < 64) ? 1ULL << m : 0), (m == 64) ? 1ULL : 0};
+            if (!polynomialIsIrreducible(f)) {
+                throw invalid_argument("the defining polynomial is reducible, so it does not define a field");
+            }
+            topBit = 1ULL << (m - 1);
+            barrettMu = barrettConstant(m, reduction);
+            if (buildTables) {
+                defineFieldTables();
+            }
+            // A sparse modulus whose terms all sit in the lower half reduces in two shifted-XOR folds
+            reducer = reductionMethod::barrett;
+            int middleTerms = __builtin_popcountll(reduction & ~1ULL);
+            if (m >= 2 && (reduction & 1) && (middleTerms == 1 || middleTerms == 3) && polynomialDegree(reduction) <= m / 2) {
+                int count = 0;
+                for (int k=m-1; k>=1; k--) {
+                    if ((reduction >> k) & 1)
+                        sparseTerms[count++] = k;
+                }
+                reducer = (middleTerms == 1) ? reductionMethod::trinomial : reductionMethod::pentanomial;
+            }
+            modulusShape = reducer;
+            if (tables) {
+                multiplier = multiplyMethod::table;
+            } else if (cpuFeatures::get().pclmul) {
+                multiplier = multiplyMethod::clmulHardware;
+                // The folds have lower latency than Barrett's two extra PCLMULQDQs (about 8 vs 12 ns), but a
+                // pentanomial above 32 bits needs two-word folds and loses about half of Barrett's throughput
+                if (reducer == reductionMethod::pentanomial && m > 32) {
+                    reducer = reductionMethod::barrett;
+                }
+            } else if (m >= 40 || reducer != reductionMethod::barrett) {
+                // The windowed product costs about the same for any m; shift-and-add grows with m. With a
+                // sparse modulus only one windowed product is needed, which wins from m = 8 up
+                multiplier = multiplyMethod::clmulPortable;
+            } else {
+                multiplier = multiplyMethod::shiftAndAdd;
+            }
+            // With the Frobenius powers tabulated, Itoh-Tsujii is about log2(m) products and table walks, which
+            // beats Euclid's ~2m word steps when products are PCLMULQDQ (about 240 vs 440 ns at m = 64); with
+            // the portable product Euclid is still ahead
+            if (tables) {
+                inverter = inversionMethod::table;
+            } else if (multiplier == multiplyMethod::clmulHardware) {
+                inverter = inversionMethod::itohTsujii;
+            } else {
+                inverter = inversionMethod::euclid;
+            }
+            sqrtX = frobenius(xElement(), degree - 1);
+            if (!tables) {
+                defineFrobeniusMaps();
+            }
+            defineTrace();
+            defineQuadraticSolver();
+            primitive = testPrimitive();
+        }
+
+        int getDegree() const {
+            return degree;
+        }
+        // Whether x generates the multiplicative group, i.e. the powers of x enumerate every nonzero element
+        bool isPrimitive() const {
+            return primitive;
+        }
+        const fieldTables* getTables() const {
+            return tables.get();
+        }
+        multiplyMethod getMultiplyMethod() const {
+            return multiplier;
+        }
+        void setMultiplyMethod(multiplyMethod method) {
+            if (method == multiplyMethod::table && !tables) {
+                return;
+            }
+#if GALOIS_X86
+            if (method == multiplyMethod::clmulHardware && !cpuFeatures::get().pclmul) {
+                return;
+            }
+#else
+            if (method == multiplyMethod::clmulHardware) {
+                return;
+            }
+#endif
+            multiplier = method;
+        }
+        reductionMethod getReductionMethod() const {
+            return reducer;
+        }
+        // Barrett is always allowed; a sparse method only for the modulus shape it was detected for
+        void setReductionMethod(reductionMethod method) {
+            if (method == reductionMethod::barrett || method == modulusShape) {
+                reducer = method;
+            }
+        }
+        inversionMethod getInversionMethod() const {
+            return inverter;
+        }
+        void setInversionMethod(inversionMethod method) {
+            // Falls back to Euclid if tables were requested but the field has none
+            inverter = (method == inversionMethod::table && !tables) ? inversionMethod::euclid : method;
+        }
+
+        // Bit-serial product of two m-bit values, the reference multiply
+        uint64_t shiftAndAddMultiply(uint64_t a, uint64_t b) const {
+            uint64_t product = 0;
+            for (int i=0; i<degree; i++) {
+                if ((b >> i) & 1)
+                    product ^= a;
+                if (a & topBit)
+                    a = ((a << 1) & mask) ^ reduction;
+                else
+                    a = (a << 1) & mask;
+            }
+            return product;
+        }
+
+#if GALOIS_X86
+        uint64_t clmulHardwareMultiply(uint64_t a, uint64_t b) const {
+            switch (reducer) {
+                case reductionMethod::trinomial:
+                    return multiplyModHardwareSparse<1>(a, b, degree, mask, sparseTerms);
+                case reductionMethod::pentanomial:
+                    return multiplyModHardwareSparse<3>(a, b, degree, mask, sparseTerms);
+                default:
+                    return multiplyModHardware(a, b, degree, mask, reduction, barrettMu);
+            }
+        }
+#endif
+        uint64_t clmulPortableMultiply(uint64_t a, uint64_t b) const {
+            switch (reducer) {
+                case reductionMethod::trinomial:
+                    return multiplyModPortableSparse<1>(a, b, degree, mask, sparseTerms);
+                case reductionMethod::pentanomial:
+                    return multiplyModPortableSparse<3>(a, b, degree, mask, sparseTerms);
+                default:
+                    return multiplyModPortable(a, b, degree, mask, reduction, barrettMu);
+            }
+        }
+
+        uint64_t clmulMultiply(uint64_t a, uint64_t b) const {
+#if GALOIS_X86
+            if (cpuFeatures::get().pclmul) {
+                return clmulHardwareMultiply(a, b);
+            }
+#endif
+            return clmulPortableMultiply(a, b);
+        }
+
+        uint64_t multiply(uint64_t a, uint64_t b) const {
+            switch (multiplier) {
+                case multiplyMethod::table:
+                    return tables->multiply((uint32_t)a, (uint32_t)b);
+#if GALOIS_X86
+                case multiplyMethod::clmulHardware:
+                    return clmulHardwareMultiply(a, b);
+#endif
+                case multiplyMethod::clmulPortable:
+                    return clmulPortableMultiply(a, b);
+                default:
+                    return shiftAndAddMultiply(a, b);
+            }
+        }
+
+        /*
+            a^2 is linear in a: the bits of a spread to the even positions, then reduced. PCLMULQDQ squares in one
+            instruction already; otherwise PDEP (or shifts and masks) replaces the windowed or bit-serial product.
+        */
+        uint64_t square(uint64_t a) const {
+            switch (multiplier) {
+                case multiplyMethod::table:
+                    return tables->multiply((uint32_t)a, (uint32_t)a);
+#if GALOIS_X86
+                case multiplyMethod::clmulHardware:
+                    return clmulHardwareMultiply(a, a);
+#endif
+                default:
+                    return reduceProduct(clmulSquare(a));
+            }
+        }
+
+        /*
+            The square root a^(2^(m-1)): with a = E(x)^2 + x*O(x)^2 for the even and odd bits of a,
+            sqrt(a) = E(x) + sqrt(x)*O(x), one multiplication by the precomputed sqrt(x)
+        */
+        uint64_t sqrt(uint64_t a) const {
+            uint64_t halves = evenOddBits(a);
+            return (halves & 0xFFFFFFFFULL) ^ multiply(sqrtX, halves >> 32);
+        }
+
+        // Tr(a) = a + a^2 + a^4 + ... + a^(2^(m-1)), which is 0 or 1
+        int trace(uint64_t a) const {
+            return __builtin_popcountll(a & traceMask) & 1;
+        }
+
+        // H(a) = a + a^4 + a^16 + ... + a^(4^((m-1)/2)), odd m only; H(c)^2 + H(c) = c + Tr(c)
+        uint64_t halfTrace(uint64_t a) const {
+            if (!(degree & 1)) {
+                throw invalid_argument("the half-trace needs odd m");
+            }
+            return quadraticSolver->apply(a);
+        }
+
+        // A root z of z^2 + z = c, false when there is none (Tr(c) = 1); the other root is z + 1
+        bool solveQuadratic(uint64_t c, uint64_t &z) const {
+            if (trace(c)) {
+                return false;
+            }
+            z = quadraticSolver->apply(c);
+            return true;
+        }
+
+        /**
+         * Roots of a*z^2 + b*z + c = 0; with a, b != 0 the substitution z = (b/a)*y turns it into
+         * y^2 + y = a*c/b^2
+         *
+         * @param roots Receives the distinct roots, room for 2
+         * @return The number of distinct roots, 0 to 2
+         * @throws invalid_argument if a = b = 0
+         */
+        int solveQuadratic(uint64_t a, uint64_t b, uint64_t c, uint64_t *roots) const {
+            if (a == 0 && b == 0) {
+                throw invalid_argument("a*z^2 + b*z + c with a = b = 0 is not a quadratic");
+            }
+            if (a == 0) {
+                roots[0] = divide(c, b);
+                return 1;
+            }
+            if (b == 0) {
+                roots[0] = sqrt(divide(c, a)); // a double root
+                return 1;
+            }
+            uint64_t y, scale = divide(b, a);
+            if (!solveQuadratic(multiply(multiply(a, c), inverse(square(b))), y)) {
+                return 0;
+            }
+            roots[0] = multiply(scale, y);
+            roots[1] = roots[0] ^ scale; // (b/a)*(y+1)
+            return 2;
+        }
+
+        // The map a -> a^(2^k) as byte tables, for callers that apply one Frobenius power many times
+        linearMapTables frobeniusMap(int k) const {
+            return linearMapTables(degree, [this, k](int i) {
+                uint64_t basis = 1ULL << i;
+                for (int j=0; j<k; j++) {
+                    basis = square(basis);
+                }
+                return basis;
+            });
+        }
+
+        // a^(2^k); a tabulated map when the field has one for k, else k squarings
+        uint64_t frobenius(uint64_t a, int k) const {
+            if (frobeniusMaps && k > 1) {
+                for (auto &map: *frobeniusMaps) {
+                    if (map.first == k) {
+                        return map.second.apply(a);
+                    }
+                }
+            }
+            for (int i=0; i<k; i++) {
+                a = square(a);
+            }
+            return a;
+        }
+
+        // The inverse of 0 is defined as 0
+        uint64_t inverse(uint64_t a) const {
+            switch (inverter) {
+                case inversionMethod::table:
+                    return tables->inverse((uint32_t)a);
+                case inversionMethod::itohTsujii:
+                    return inverseItohTsujii(a);
+                default:
+                    return inverseEuclid(a);
+            }
+        }
+
+        uint64_t inverseTable(uint64_t a) const {
+            return tables ? tables->inverse((uint32_t)a) : inverseEuclid(a);
+        }
+
+        /*
+            Itoh-Tsujii: a^-1 = a^(2^m-2) = (a^(2^(m-1)-1))^2.
+            With beta_k = a^(2^k-1), beta_(j+k) = beta_j^(2^k) * beta_k, so walking the bits of m-1 from the top
+            gives beta_(m-1) in about log2(m) products and m-2 squarings.
+        */
+        uint64_t inverseItohTsujii(uint64_t a) const {
+            if (a == 0 || degree == 1) {
+                return a;
+            }
+            int n = degree - 1;
+            int top = 31;
+            while (!((n >> top) & 1))
+                top--;
+            uint64_t beta = a; // beta_1
+            int k = 1;
+            for (int i=top-1; i>=0; i--) {
+                beta = multiply(frobenius(beta, k), beta); // beta_2k
+                k *= 2;
+                if ((n >> i) & 1) {
+                    beta = multiply(square(beta), a); // beta_(k+1)
+                    k++;
+                }
+            }
+            return square(beta);
+        }
+
+        /*
+            Extended Euclid over GF(2)[x] with leading-zero-count shifts (Hankerson, Menezes, Vanstone
+            Algorithm 2.48), see polynomialInverseMod. Each step cancels the leading term of the larger of u, v,
+            so the loop runs about 2m times on word-wide XORs.
+            Returns 0 when a has no inverse (a = 0 or the defining polynomial is reducible).
+        */
+        uint64_t inverseEuclid(uint64_t a) const {
+            return polynomialInverseMod(a, degree, reduction);
+        }
+
+        // Division by zero yields 0, matching the 0 entry of the old GF(2^4) inverse table
+        uint64_t divide(uint64_t a, uint64_t b) const {
+            if (inverter == inversionMethod::table) {
+                return tables->divide((uint32_t)a, (uint32_t)b);
+            }
+            return multiply(a, inverse(b));
+        }
+
+        // Negative exponents are powers of the inverse
+        uint64_t power(uint64_t a, long long exponent) const {
+            if (tables) {
+                return tables->power((uint32_t)a, exponent);
+            }
+            if (exponent < 0) {
+                return powerUnsigned(inverse(a), 0 - (uint64_t)exponent);
+            }
+            return powerUnsigned(a, (uint64_t)exponent);
+        }
+
+        /*
+            a^exponent by sliding windows: the exponent is scanned from the top in windows of up to w bits that
+            end in a 1, each costing one product by a precomputed odd power a, a^3, ..., a^(2^w - 1). That is
+            about bits/(w+1) products instead of bits/2 for square-and-multiply, with the table on the stack.
+        */
+        uint64_t powerUnsigned(uint64_t a, uint64_t exponent) const {
+            if (a == 0) {
+                return (exponent == 0) ? 1 : 0;
+            }
+            if (tables) {
+                return tables->power((uint32_t)a, (long long)(exponent % tables->order));
+            }
+            // a^(2^m - 1) = 1 for a != 0
+            exponent %= mask;
+            if (exponent == 0) {
+                return 1;
+            }
+            int bits = 64 - __builtin_clzll(exponent);
+            // Precomputing 2^(w-1) odd powers pays back bits/(w+1) products: w = 3 is best up to 64 bits
+            int width = (bits > 24) ? 3 : (bits > 6) ? 2 : 1;
+            uint64_t odd[4] = {a};
+            if (width > 1) {
+                uint64_t a2 = square(a);
+                for (int i=1; i < (1 << (width - 1)); i++) {
+                    odd[i] = multiply(odd[i-1], a2);
+                }
+            }
+            uint64_t result = 1;
+            bool started = false;
+            int i = bits - 1;
+            while (i >= 0) {
+                if (!((exponent >> i) & 1)) {
+                    result = square(result);
+                    i--;
+                    continue;
+                }
+                // The longest window from bit i down that fits in width bits and ends in a 1
+                int j = max(i - width + 1, 0);
+                while (!((exponent >> j) & 1))
+                    j++;
+                uint64_t window = (exponent >> j) & ((1ULL << (i - j + 1)) - 1);
+                if (started) {
+                    for (int k=j; k<=i; k++) {
+                        result = square(result);
+                    }
+                    result = multiply(result, odd[window >> 1]);
+                } else {
+                    result = odd[window >> 1];
+                    started = true;
+                }
+                i = j - 1;
+            }
+            return result;
+        }
+};
+
+
+/**
+ * Powers of one fixed base g, e.g. a primitive element whose powers fill a Vandermonde matrix
+ *
+ * Lim-Lee comb: the exponent's m bits are read as teeth rows of d = ceil(m/teeth) bits. With
+ * table[s] = the product of g^(2^(i*d)) over the set bits i of s (2^teeth entries, built once), g^e takes d
+ * squarings and d products, about a third of a general power at m = 64 and with no allocation per call.
+ * Fields with log tables skip the comb and look the power up.
+ */
+class fixedBasePower {
+    private:
+        fieldArithmetic arithmetic;
+        uint64_t base;
+        int teeth;
+        int spacing; // d
+        vector<uint64_t> table;
+
+    public:
+        /**
+         * @param field Arithmetic of the field g lives in
+         * @param g The base
+         * @param teethCount Comb teeth, 1 to 16; the table has 2^teethCount entries
+         */
+        fixedBasePower(const fieldArithmetic &field, uint64_t g, int teethCount = 8) : arithmetic(field), base(g) {
+            if (teethCount < 1 || teethCount > 16) {
+                throw invalid_argument("a comb needs 1 to 16 teeth");
+            }
+            int m = arithmetic.getDegree();
+            teeth = min(teethCount, m);
+            spacing = (m + teeth - 1) / teeth;
+            if (arithmetic.getTables()) {
+                return;
+            }
+            vector<uint64_t> rows(teeth);
+            for (int i=0; i<teeth; i++) {
+                rows[i] = arithmetic.frobenius(g, i * spacing); // g^(2^(i*d))
+            }
+            table.assign((size_t)1 << teeth, 1);
+            for (size_t s=1; s<table.size(); s++) {
+                table[s] = arithmetic.multiply(table[s & (s - 1)], rows[__builtin_ctzll(s)]);
+            }
+        }
+
+        uint64_t getBase() const {
+            return base;
+        }
+
+        // g^exponent
+        uint64_t power(uint64_t exponent) const {
+            if (table.empty() || base == 0) {
+                return arithmetic.powerUnsigned(base, exponent);
+            }
+            int m = arithmetic.getDegree();
+            exponent %= (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+            uint64_t result = 1;
+            for (int column=spacing-1; column>=0; column--) {
+                result = arithmetic.square(result);
+                size_t index = 0;
+                // The last row may be partly past bit m-1
+                for (int i=0; i<teeth && i*spacing+column<m; i++) {
+                    index |= (size_t)((exponent >> (i * spacing + column)) & 1) << i;
+                }
+                if (index) {
+                    result = arithmetic.multiply(result, table[index]);
+                }
+            }
+            return result;
+        }
+};
+
+
+/**
+ * Element of GF(2^m)
+ *
+ * Only the m-bit polynomial representation is stored; the defining polynomial is held once by the owning
+ * GaloisField, which performs multiplication and division. Elements are trivially copyable and a vector
+ * of them is a contiguous array of Words. Use the narrowest Word that holds m bits (see elementWord).
+ */
+template <typename Word>
+class basicFieldElement {
+    private:
+        Word value;
+    public:
+
+        // Number of trailing zero bits, 8*sizeof(Word) for 0
+        int getTrailingZeros(Word bits) {
+            return bits ? __builtin_ctzll(bits) : (int)(8 * sizeof(Word));
+        }
+
+        // Greatest common divisor of two polynomials in GF(2)[x], see polynomialGCD
+        basicFieldElement fieldElementGCD(basicFieldElement u, basicFieldElement v) {
+            return basicFieldElement((Word)polynomialGCD(u.value, v.value));
+        }
+
+        /**
+         * Bezout coefficients of two polynomials: s*a + t*b = gcd(a, b) in GF(2)[x]
+         *
+         * With b the defining polynomial (when it fits in a Word) the gcd is 1 and s is the inverse of a.
+         * @param trace If set, each division step is written to it
+         */
+        polynomialBezout getBezoutCoefficients(basicFieldElement aElem, basicFieldElement bElem, ostream *trace = nullptr) {
+            return polynomialExtendedGCD(aElem.value, bElem.value, trace);
+        }
+
+        constexpr Word getValue () const {
+            return value;
+        }
+        void setValue (Word newVal) {
+            value = newVal;
+        }
+
+
+        // Addition and subtraction in a binary extension field are identical to the bitwise XOR of the binary
+        // representations of the polynomials, so they need no defining polynomial
+        constexpr basicFieldElement operator + (basicFieldElement const &input) const {
+            return basicFieldElement(value ^ input.value);
+        }
+        constexpr basicFieldElement operator - (basicFieldElement const &input) const {
+            return basicFieldElement(value ^ input.value);
+        }
+        constexpr bool operator == (basicFieldElement const &input) const {
+            return value == input.value;
+        }
+        constexpr bool operator != (basicFieldElement const &input) const {
+            return value != input.value;
+        }
+
+        constexpr basicFieldElement(Word val) : value(val) {
+        }
+        constexpr basicFieldElement() : value(0) {
+            // Default constructor; the zero element
+        }
+
+}; // end basicFieldElement class
+
+// Narrowest unsigned word that holds an element of GF(2^m)
+template <unsigned m>
+using elementWord = typename conditional<(m <= 8), uint8_t,
+                    typename conditional<(m <= 16), uint16_t,
+                    typename conditional<(m <= 32), uint32_t, uint64_t>::type>::type>::type;
+
+// Element type used by the runtime GaloisField, wide enough for any m <= 64
+typedef basicFieldElement<uint64_t> fieldElement;
+
+static_assert(is_trivially_copyable<fieldElement>::value, "field elements must be trivially copyable");
+static_assert(sizeof(basicFieldElement<uint8_t>) == 1, "field elements must carry no per-element state");
+
+
+/**
+ * The elements of a field as a read-only random access range
+ *
+ * Nothing is stored: the element at index i is the polynomial whose binary representation is i, so it is
+ * produced on demand when the iterator is dereferenced. Enumeration needs 2^m to fit in a uint64_t (m < 64).
+ */
+class fieldElementRange {
+    private:
+        uint64_t count;
+    public:
+        class iterator {
+            private:
+                uint64_t index;
+            public:
+                typedef random_access_iterator_tag iterator_category;
+                typedef fieldElement value_type;
+                typedef int64_t difference_type;
+                typedef const fieldElement* pointer;
+                typedef fieldElement reference; // elements are values, there is nothing to refer to
+
+                iterator(uint64_t i = 0) : index(i) {
+                }
+                fieldElement operator * () const {
+                    return fieldElement(index);
+                }
+                fieldElement operator [] (difference_type n) const {
+                    return fieldElement(index + n);
+                }
+                iterator& operator ++ () {
+                    index++;
+                    return *this;
+                }
+                iterator operator ++ (int) {
+                    iterator old = *this;
+                    index++;
+                    return old;
+                }
+                iterator& operator -- () {
+                    index--;
+                    return *this;
+                }
+                iterator operator -- (int) {
+                    iterator old = *this;
+                    index--;
+                    return old;
+                }
+                iterator& operator += (difference_type n) {
+                    index += n;
+                    return *this;
+                }
+                iterator& operator -= (difference_type n) {
+                    index -= n;
+                    return *this;
+                }
+                iterator operator + (difference_type n) const {
+                    return iterator(index + n);
+                }
+                iterator operator - (difference_type n) const {
+                    return iterator(index - n);
+                }
+                difference_type operator - (iterator const &other) const {
+                    return (difference_type)(index - other.index);
+                }
+                bool operator == (iterator const &other) const {
+                    return index == other.index;
+                }
+                bool operator != (iterator const &other) const {
+                    return index != other.index;
+                }
+                bool operator < (iterator const &other) const {
+                    return index < other.index;
+                }
+                bool operator > (iterator const &other) const {
+                    return index > other.index;
+                }
+                bool operator <= (iterator const &other) const {
+                    return index <= other.index;
+                }
+                bool operator >= (iterator const &other) const {
+                    return index >= other.index;
+                }
+        };
+
+        fieldElementRange(uint64_t size) : count(size) {
+        }
+        iterator begin() const {
+            return iterator(0);
+        }
+        iterator end() const {
+            return iterator(count);
+        }
+        uint64_t size() const {
+            return count;
+        }
+        // @throws out_of_range past the last element
+        fieldElement operator [] (uint64_t index) const {
+            if (index >= count) {
+                throw out_of_range("field element index out of range");
+            }
+            return fieldElement(index);
+        }
+};
+
+
+class GaloisField {
+
+private:
+    int degree = 3; // m where GaloisField(2^m)
+    int elementBitSize = degree; // number of bits needed to represent the polynomial elements
+    uint64_t polynomialVal = 13; // Defaults to defining polynomial of x^3+x^2+1 (1101)
+    fieldArithmetic arithmetic; // defining polynomial, log/antilog tables and inversion engine
+    regionKernel kernel = bestRegionKernel(); // SIMD kernel for the region operations
+    ostream *traceStream = nullptr; // where add/subtract/multiply/divide explain themselves, if anywhere
+
+    template <typename Word>
+    void traceOperation(basicFieldElement<Word> a, char op, basicFieldElement<Word> b, basicFieldElement<Word> result) {
+        if (traceStream) {
+            *traceStream << elementToBinary(a) << op << elementToBinary(b) << "=" << elementToBinary(result) << "\n";
+        }
+    }
+
+    template <bool Accumulate>
+    void regionMultiplyWith(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c) {
+        regionMultiply8<Accumulate>(src, dst, n, c, kernel);
+    }
+    template <bool Accumulate, typename Word>
+    void regionMultiplyWith(const Word *src, Word *dst, size_t n, const wideMultiplier<Word> &c) {
+        regionMultiplyWide<Accumulate>(src, dst, n, c, kernel);
+    }
+
+
+
+public:
+    // Move to private after testing
+    int polynomialStringToInt(string polynomial) {
+
+        // Note: Can possibly copy or modify the code at the bottom of this page: https://cplusplus.com/forum/general/118352/
+
+        /*
+            1. find all "x^"
+                a) also find just "x" without a "^", this is x^1s
+            2. find all chars on the left side of "x^"
+                *) This will be the coefficent of the term
+                *) Make sure it isn't an operator or whitespace or outside the bounds
+            3. find all chars on the right side of "x^"
+                *) This will be the power for each term
+            4. Mod 2 all coefficients (to keep it in binary extension field {0, 1})
+            5. Mod p(x) polynomial to keep it in range
+            6. Convert to binary representation (outside of this function or change the return type)
+        */
+
+
+        // Get index of every x
+        vector<int> xIndices;
+        vector<int> xCoefficients;
+        vector<int> xPowers;
+        cout << "x at ";
+        for (int i=0; i<polynomial.size(); i++) {
+            if (polynomial[i] == 'x') {
+                xIndices.push_back(i);
+                cout << i;
+            }
+        }
+        cout << endl;
+        for (auto it: xIndices) {
+            vector<char> blacklist = {'+', '-', '*', '/', ' '};
+            if (it == 0) {
+                // No leading coefficient on first term
+                xCoefficients.push_back(0);
+            } else {
+                if (find(blacklist.begin(), blacklist.end(), polynomial[it-1]) != blacklist.end()) {
+                    // If the char before x is not a number, its not a coefficient
+
+                    // Not sure if this is the most efficient way to do this, I'm open to scrapping this function entirely
+                }
+            }
+        }
+        return 0;
+    }
+
+    int getDegree() {
+        return degree;
+    }
+    void setDegree(int m){
+        degree = m;
+    }
+    int getElementBitSize() {
+        return elementBitSize;
+    }
+    void setElementBitSize(int s) {
+        elementBitSize = s;
+    }
+    uint64_t getPolynomialVal() {
+        return polynomialVal;
+    }
+
+    // Number of elements, 2^m; throws out_of_range for m = 64, whose 2^64 elements a uint64_t cannot count
+    uint64_t size() {
+        if (elementBitSize >= 64) {
+            throw out_of_range("GF(2^64) has too many elements to count or enumerate");
+        }
+        return 1ULL << elementBitSize;
+    }
+
+    // All 2^m elements, generated on demand rather than stored
+    fieldElementRange getElements() {
+        return fieldElementRange(size());
+    }
+    fieldElementRange::iterator begin() {
+        return getElements().begin();
+    }
+    fieldElementRange::iterator end() {
+        return getElements().end();
+    }
+
+    // True if multiply/divide/inverse/power for this field go through log/antilog tables
+    bool hasTables() {
+        return arithmetic.getTables() != nullptr;
+    }
+    // Whether the defining polynomial is primitive (x generates the multiplicative group)
+    bool isPrimitive() {
+        return arithmetic.isPrimitive();
+    }
+
+    inversionMethod getInversionMethod() {
+        return arithmetic.getInversionMethod();
+    }
+
+    const fieldArithmetic& getArithmetic() const {
+        return arithmetic;
+    }
+
+
+    // The following functions are the field operations over elements of this field. Word may be any
+    // unsigned type with at least m bits, so e.g. basicFieldElement<uint8_t> works for m <= 8.
+    // They have no side effects unless tracing is on.
+
+    /**
+     * Explain each add/subtract/multiply/divide on out, one line per operation such as 0101*0111=1000
+     *
+     * @param out Stream to write to, or nullptr (the default) to turn tracing off
+     */
+    void setTrace(ostream *out) {
+        traceStream = out;
+    }
+    ostream *getTrace() {
+        return traceStream;
+    }
+
+    template <typename Word>
+    basicFieldElement<Word> add(basicFieldElement<Word> a, basicFieldElement<Word> b) {
+        basicFieldElement<Word> sum = a + b;
+        traceOperation(a, '+', b, sum);
+        return sum;
+    }
+
+    template <typename Word>
+    basicFieldElement<Word> subtract(basicFieldElement<Word> a, basicFieldElement<Word> b) {
+        basicFieldElement<Word> difference = a - b;
+        traceOperation(a, '-', b, difference);
+        return difference;
+    }
+
+    template <typename Word>
+    basicFieldElement<Word> multiply(basicFieldElement<Word> a, basicFieldElement<Word> b) {
+        basicFieldElement<Word> product((Word)arithmetic.multiply(a.getValue(), b.getValue()));
+        traceOperation(a, '*', b, product);
+        return product;
+    }
+
+    template <typename Word>
+    basicFieldElement<Word> divide(basicFieldElement<Word> a, basicFieldElement<Word> b) {
+        basicFieldElement<Word> quotient((Word)arithmetic.divide(a.getValue(), b.getValue()));
+        traceOperation(a, '/', b, quotient);
+        return quotient;
+    }
+
+    // Multiplicative inverse; the inverse of 0 is defined as 0
+    template <typename Word>
+    basicFieldElement<Word> inverse(basicFieldElement<Word> a) {
+        return basicFieldElement<Word>((Word)arithmetic.inverse(a.getValue()));
+    }
+
+    template <typename Word>
+    basicFieldElement<Word> square(basicFieldElement<Word> a) {
+        return basicFieldElement<Word>((Word)arithmetic.square(a.getValue()));
+    }
+
+    // The unique b with b^2 = a (squaring is a bijection in characteristic 2)
+    template <typename Word>
+    basicFieldElement<Word> sqrt(basicFieldElement<Word> a) {
+        return basicFieldElement<Word>((Word)arithmetic.sqrt(a.getValue()));
+    }
+
+    // a^(2^k), the k-fold Frobenius map
+    template <typename Word>
+    basicFieldElement<Word> frobenius(basicFieldElement<Word> a, int k) {
+        return basicFieldElement<Word>((Word)arithmetic.frobenius(a.getValue(), k));
+    }
+
+    // Raise an element to an integer power; negative exponents are powers of the inverse
+    template <typename Word>
+    basicFieldElement<Word> power(basicFieldElement<Word> a, long long exponent) {
+        return basicFieldElement<Word>((Word)arithmetic.power(a.getValue(), exponent));
+    }
+
+    // Tr(a), 0 or 1
+    template <typename Word>
+    int trace(basicFieldElement<Word> a) {
+        return arithmetic.trace(a.getValue());
+    }
+
+    // The half-trace, odd m only
+    template <typename Word>
+    basicFieldElement<Word> halfTrace(basicFieldElement<Word> a) {
+        return basicFieldElement<Word>((Word)arithmetic.halfTrace(a.getValue()));
+    }
+
+    /**
+     * Roots of a*z^2 + b*z + c = 0 (z^2 + z = c is a = b = 1)
+     *
+     * @param roots Receives the distinct roots, room for 2
+     * @return The number of distinct roots, 0 to 2
+     */
+    template <typename Word>
+    int solveQuadratic(basicFieldElement<Word> a, basicFieldElement<Word> b, basicFieldElement<Word> c, basicFieldElement<Word> *roots) {
+        uint64_t values[2];
+        int count = arithmetic.solveQuadratic(a.getValue(), b.getValue(), c.getValue(), values);
+        for (int i=0; i<count; i++) {
+            roots[i] = basicFieldElement<Word>((Word)values[i]);
+        }
+        return count;
+    }
+
+    // a^exponent over the whole unsigned range
+    template <typename Word>
+    basicFieldElement<Word> pow(basicFieldElement<Word> a, uint64_t exponent) {
+        return basicFieldElement<Word>((Word)arithmetic.powerUnsigned(a.getValue(), exponent));
+    }
+
+    // Precomputation for many powers of the same base g, see fixedBasePower
+    template <typename Word>
+    fixedBasePower fixedBase(basicFieldElement<Word> g, int teeth = 8) {
+        return fixedBasePower(arithmetic, g.getValue(), teeth);
+    }
+
+    /**
+     * Invert n elements in place (0 stays 0)
+     *
+     * Montgomery's trick: with prefix products p_i = a_0...a_i, one inversion of p_(n-1) followed by a walk
+     * back down gives every a_i^-1 = p_(i-1) * (a_i...a_(n-1))^-1, for 3(n-1) multiplications in total.
+     * With log/antilog tables a lookup per element is cheaper still, so that is used instead.
+     */
+    template <typename Word>
+    void batchInverse(basicFieldElement<Word> *elements, size_t n) {
+        if (arithmetic.getInversionMethod() == inversionMethod::table) {
+            for (size_t i=0; i<n; i++) {
+                elements[i].setValue((Word)arithmetic.inverse(elements[i].getValue()));
+            }
+            return;
+        }
+        // Zeros are skipped (multiplied in as 1) so they do not wipe out the whole batch
+        vector<uint64_t> prefix(n);
+        uint64_t product = 1;
+        for (size_t i=0; i<n; i++) {
+            if (elements[i].getValue() != 0) {
+                product = arithmetic.multiply(product, elements[i].getValue());
+            }
+            prefix[i] = product;
+        }
+        uint64_t inverse = arithmetic.inverse(product); // (a_0...a_i)^-1 as i walks down
+        for (size_t i=n; i-- > 0; ) {
+            uint64_t a = elements[i].getValue();
+            if (a == 0) {
+                continue;
+            }
+            uint64_t before = (i > 0) ? prefix[i-1] : 1;
+            elements[i].setValue((Word)arithmetic.multiply(inverse, before));
+            inverse = arithmetic.multiply(inverse, a);
+        }
+    }
+    template <typename Word>
+    void batchInverse(vector<basicFieldElement<Word>> &elements) {
+        batchInverse(elements.data(), elements.size());
+    }
+
+    /**
+     * batchInverse split into chunks over several threads; each chunk pays one inversion of its own
+     *
+     * @param threads Number of threads, 0 for one per hardware thread
+     */
+    template <typename Word>
+    void batchInverseParallel(basicFieldElement<Word> *elements, size_t n, unsigned threads = 0) {
+        const size_t minimumChunk = 4096; // below this a thread costs more than it saves
+        if (threads == 0) {
+            threads = max(1u, thread::hardware_concurrency());
+        }
+        threads = (unsigned)min<size_t>(threads, max<size_t>(1, n / minimumChunk));
+        if (threads <= 1) {
+            batchInverse(elements, n);
+            return;
+        }
+        vector<thread> workers;
+        size_t chunk = (n + threads - 1) / threads;
+        for (size_t start=chunk; start<n; start+=chunk) {
+            workers.emplace_back([this, elements, start, chunk, n]() {
+                batchInverse(elements + start, min(chunk, n - start));
+            });
+        }
+        batchInverse(elements, min(chunk, n));
+        for (auto &worker: workers) {
+            worker.join();
+        }
+    }
+
+    /**
+     * The tables a region operation by the constant c is built from
+     *
+     * The region operations below build them on every call; callers that apply one constant to many buffers
+     * (ReedSolomon, per generator coefficient) build them once here and pass them instead of c.
+     * @throws invalid_argument if elements do not fit in Word
+     */
+    template <typename Word>
+    regionMultiplier<Word> makeRegionMultiplier(basicFieldElement<Word> c) {
+        if (elementBitSize > (int)(8 * sizeof(Word))) {
+            throw invalid_argument("region operations need elements that fit in the buffer's word size");
+        }
+        if constexpr (sizeof(Word) == 1) {
+            return makeGf8Multiplier(c.getValue(), elementBitSize, [this](uint8_t a, uint8_t b) { return arithmetic.multiply(a, b); });
+        } else {
+            regionMultiplier<Word> table;
+            makeWideMultiplier(table, c.getValue(), elementBitSize, polynomialVal, [this](Word a, Word b) { return arithmetic.multiply(a, b); });
+            return table;
+        }
+    }
+
+    /**
+     * Region multiply: dst[i] = c * src[i] for n byte-sized elements (m <= 8)
+     *
+     * Uses the fastest SIMD kernel the CPU supports (GFNI, AVX-512, AVX2, SSSE3, then scalar).
+     * src and dst may be the same buffer.
+     */
+    void regionMultiply(const uint8_t *src, uint8_t *dst, size_t n, basicFieldElement<uint8_t> c) {
+        regionMultiplyWith<false>(src, dst, n, makeRegionMultiplier(c));
+    }
+
+    // Region multiply-accumulate: dst[i] ^= c * src[i] for n byte-sized elements (m <= 8)
+    void regionMultiplyXor(const uint8_t *src, uint8_t *dst, size_t n, basicFieldElement<uint8_t> c) {
+        regionMultiplyWith<true>(src, dst, n, makeRegionMultiplier(c));
+    }
+
+    // The same over 16-bit words (m <= 16) with split 4-bit tables through SSSE3/AVX2 PSHUFB
+    void regionMultiply(const uint16_t *src, uint16_t *dst, size_t n, basicFieldElement<uint16_t> c) {
+        regionMultiplyWith<false>(src, dst, n, makeRegionMultiplier(c));
+    }
+    void regionMultiplyXor(const uint16_t *src, uint16_t *dst, size_t n, basicFieldElement<uint16_t> c) {
+        regionMultiplyWith<true>(src, dst, n, makeRegionMultiplier(c));
+    }
+
+    // And over 32-bit words (m <= 32); setRegionKernel(regionKernel::clmul) selects the PCLMULQDQ kernel
+    void regionMultiply(const uint32_t *src, uint32_t *dst, size_t n, basicFieldElement<uint32_t> c) {
+        regionMultiplyWith<false>(src, dst, n, makeRegionMultiplier(c));
+    }
+    void regionMultiplyXor(const uint32_t *src, uint32_t *dst, size_t n, basicFieldElement<uint32_t> c) {
+        regionMultiplyWith<true>(src, dst, n, makeRegionMultiplier(c));
+    }
+
+    // The region operations with tables from makeRegionMultiplier of this field
+    template <typename Word>
+    void regionMultiply(const Word *src, Word *dst, size_t n, const regionMultiplier<Word> &c) {
+        regionMultiplyWith<false>(src, dst, n, c);
+    }
+    template <typename Word>
+    void regionMultiplyXor(const Word *src, Word *dst, size_t n, const regionMultiplier<Word> &c) {
+        regionMultiplyWith<true>(src, dst, n, c);
+    }
+
+    regionKernel getRegionKernel() {
+        return kernel;
+    }
+    // Force a kernel, e.g. to benchmark them; ignored if the CPU lacks it
+    void setRegionKernel(regionKernel k) {
+        if (regionKernelSupported(k)) {
+            kernel = k;
+        }
+    }
+
+    // m-character binary representation of an element, most significant coefficient first
+    template <typename Word>
+    string elementToBinary(basicFieldElement<Word> element) {
+        string bits(elementBitSize, '0');
+        for (int i=0; i<elementBitSize; i++) {
+            if ((element.getValue() >> i) & 1) {
+                bits[elementBitSize-1-i] = '1';
+            }
+        }
+        return bits;
+    }
+
+
+    // Overload the [] operator so that you can do GaloisField[0] to get the 0th fieldElement object
+    // @throws out_of_range if index is not below 2^m
+    fieldElement operator[] (uint64_t index) {
+        if (elementBitSize < 64 && (index >> elementBitSize) != 0) {
+            throw out_of_range("field element index out of range");
+        }
+        return fieldElement(index);
+    }
+
+    void binaryToPolynomial(fieldElement element) {
+        string lineOut = "";
+        uint64_t bits = element.getValue();
+        if (bits == 0) {
+            cout << "0" << endl;
+        } else {
+            for (int i=elementBitSize-1; i>=0; i--) {
+                if ((bits >> i) & 1) {
+                    if (i == 0) {
+                        lineOut = lineOut + "1";
+                        //cout << "1"; // Anything to the 0th power is 1
+                    } else if (i == 1) {
+                        lineOut = lineOut + "x";
+                        //cout << "x";
+                    } else {
+                        lineOut = lineOut + "x^" + to_string(i);
+                        //cout << "x^" << i;
+                    }
+                if (i > 0) {
+                        lineOut = lineOut + " + ";
+                        //cout << " + ";
+                    }
+                }
+            }
+            // This part right here removes the trailing plus sign at the end of some lines
+            if (lineOut[lineOut.size()-2] == '+') {
+                cout << lineOut.substr(0,lineOut.size()-3);
+            } else {
+                cout << lineOut;
+            }
+
+            cout << endl;
+        }
+    }
+
+    void printFieldValues() {
+        for (auto element: getElements()) {
+            cout << elementToBinary(element) << endl;
+        }
+    }
+
+    /**
+     * Galois Field Class Constructor
+     *
+     * Define the Galois Field of a base of 2 with a degree m (i.e. GaloisField(2^m))
+     *
+     * @param m Degree of the polynomial of base 2
+     * @param poly Custom irreducible polynomial represented in decimal (i.e. 13 for x^3+2+1 [1101 which is 13]);
+     *             the x^m term may be left out, which m = 64 requires
+     * @throws invalid_argument if m is outside 1..64 or poly is reducible
+     */
+    GaloisField (int m, uint64_t poly) : arithmetic(m, poly) {
+        // If custom polynomial is desired, this constructor will be executed
+        degree = m;
+        elementBitSize = m;
+        polynomialVal = poly;
+    }
+
+    /**
+     * GaloisField(2^m) over the cheapest modulus to reduce by: the lowest-weight irreducible trinomial or
+     * pentanomial (see fastestModulus)
+     */
+    explicit GaloisField (int m) : GaloisField(m, defaultModulus(m)) {
+    }
+
+    // The modulus GaloisField(m) uses, without its x^m term; looked up (or searched for) once per field
+    static uint64_t defaultModulus(int m) {
+        return (m >= 2 && m <= 64) ? fastestModulus(m).reduction() : 1;
+    }
+
+    // Default constructor
+    GaloisField () : arithmetic(3, 13) {
+        degree = 3;
+        polynomialVal = 13;
+    }
+
+
+};
+
+#endif // GALOIS_FIELD_HPP
@@ -0,0 +1,198 @@
+#ifndef LARGE_GALOIS_FIELD_HPP
+#define LARGE_GALOIS_FIELD_HPP
+
+#include <array>
+#include <string>
+#include <vector>
+#include <stdexcept>
+#include "carrylessMultiply.hpp"
+#include "binaryPolynomial.hpp"
+#include "polynomialSearch.hpp"
+
+/**
+ * GF(2^M) for M past a machine word, e.g. the binary fields of elliptic curve cryptography (163, 233, 283,
+ * 409, 571) and beyond
+ *
+ * Elements are arrays of ceil(M/64) words, least significant first, so nothing is allocated per operation.
+ * Products are clmulMultiply (schoolbook, Karatsuba or Toom-3) over PCLMULQDQ (or the windowed portable product) followed by a word-level
+ * reduction that costs one shifted XOR per term of the modulus, so the trinomial or pentanomial that
+ * fastestModulus picks is the intended case; any irreducible modulus works, dense ones more slowly.
+ * Squaring spreads the bits apart in linear time, and inversion uses Itoh-Tsujii, which is mostly squarings.
+ */
+template <unsigned M>
+class LargeGaloisField {
+    static_assert(M >= 2, "LargeGaloisField needs M >= 2");
+
+    public:
+        static constexpr size_t limbs = (M + 63) / 64;
+        typedef std::array<uint64_t, limbs> element;
+
+    private:
+        typedef std::array<uint64_t, 2 * limbs> product;
+        std::vector<int> terms; // exponents below M of the modulus, including 0
+
+        element reduce(product &p) const {
+            polynomialReduce(p.data(), p.size(), (int)M, terms.data(), terms.size());
+            element result;
+            std::copy(p.begin(), p.begin() + limbs, result.begin());
+            return result;
+        }
+
+    public:
+        /**
+         * @param exponents Exponents below M of the terms of the modulus, e.g. {74, 0} for x^233 + x^74 + 1
+         * @throws invalid_argument if the modulus is reducible
+         */
+        explicit LargeGaloisField(const std::vector<int> &exponents) : terms(exponents) {
+            std::vector<uint64_t> f(M / 64 + 1, 0);
+            f[M / 64] |= 1ULL << (M % 64);
+            for (int k: terms) {
+                if (k < 0 || k >= (int)M) {
+                    throw std::invalid_argument("modulus terms must lie below x^M");
+                }
+                f[k / 64] ^= 1ULL << (k % 64);
+            }
+            if (!polynomialIsIrreducible(f)) {
+                throw std::invalid_argument("the defining polynomial is reducible, so it does not define a field");
+            }
+        }
+        explicit LargeGaloisField(const lowWeightModulus &modulus) : LargeGaloisField(modulus.terms()) {
+        }
+        // Over the lowest-weight irreducible of degree M
+        LargeGaloisField() : LargeGaloisField(fastestModulus(M)) {
+        }
+
+        const std::vector<int> &getTerms() const {
+            return terms;
+        }
+
+        static element zero() {
+            return element{};
+        }
+        static element one() {
+            element e{};
+            e[0] = 1;
+            return e;
+        }
+        static bool isZero(const element &a) {
+            for (uint64_t w: a) {
+                if (w)
+                    return false;
+            }
+            return true;
+        }
+
+        static element add(const element &a, const element &b) {
+            element sum;
+            for (size_t i=0; i<limbs; i++) {
+                sum[i] = a[i] ^ b[i];
+            }
+            return sum;
+        }
+
+        element multiply(const element &a, const element &b) const {
+            product p;
+            std::array<uint64_t, clmulScratch(limbs) + 1> scratch;
+            clmulMultiply(a.data(), b.data(), limbs, p.data(), scratch.data());
+            return reduce(p);
+        }
+
+        // a^2 is a with a zero between each pair of bits, so it costs a pass over the words plus reduction
+        element square(const element &a) const {
+            product p;
+            for (size_t i=0; i<limbs; i++) {
+                clmulProduct square = clmulSquare(a[i]);
+                p[2*i] = square.low;
+                p[2*i+1] = square.high;
+            }
+            return reduce(p);
+        }
+
+        // a^(2^k), the k-fold Frobenius map
+        element frobenius(element a, unsigned k) const {
+            for (unsigned i=0; i<k; i++) {
+                a = square(a);
+            }
+            return a;
+        }
+
+        /*
+            Itoh-Tsujii: a^-1 = (a^(2^(M-1)-1))^2. With beta_k = a^(2^k-1), beta_(j+k) = beta_j^(2^k) * beta_k,
+            so walking the bits of M-1 from the top costs about log2(M) products and M-1 squarings.
+            The inverse of 0 is defined as 0.
+        */
+        element inverse(const element &a) const {
+            if (isZero(a)) {
+                return a;
+            }
+            unsigned n = M - 1;
+            int top = 31;
+            while (!((n >> top) & 1))
+                top--;
+            element beta = a;
+            unsigned k = 1;
+            for (int i=top-1; i>=0; i--) {
+                beta = multiply(frobenius(beta, k), beta);
+                k *= 2;
+                if ((n >> i) & 1) {
+                    beta = multiply(square(beta), a);
+                    k++;
+                }
+            }
+            return square(beta);
+        }
+
+        // Division by zero yields 0
+        element divide(const element &a, const element &b) const {
+            return multiply(a, inverse(b));
+        }
+
+        element power(element a, uint64_t exponent) const {
+            element result = one();
+            while (exponent > 0) {
+                if (exponent & 1)
+                    result = multiply(result, a);
+                a = square(a);
+                exponent >>= 1;
+            }
+            return result;
+        }
+
+        // Hexadecimal, most significant digit first, optional 0x prefix
+        static element fromHex(const std::string &hex) {
+            element e{};
+            size_t start = (hex.size() > 1 && hex[0] == '0' && (hex[1] == 'x' || hex[1] == 'X')) ? 2 : 0;
+            size_t bit = 0;
+            for (size_t i=hex.size(); i-- > start; bit+=4) {
+                char c = hex[i];
+                uint64_t digit;
+                if (c >= '0' && c <= '9')
+                    digit = c - '0';
+                else if (c >= 'a' && c <= 'f')
+                    digit = c - 'a' + 10;
+                else if (c >= 'A' && c <= 'F')
+                    digit = c - 'A' + 10;
+                else
+                    throw std::invalid_argument("not a hexadecimal digit");
+                if (digit == 0)
+                    continue;
+                if (bit + 64 - __builtin_clzll(digit) > M) {
+                    throw std::invalid_argument("value has more than M bits");
+                }
+                e[bit / 64] |= digit << (bit % 64);
+            }
+            return e;
+        }
+        static std::string toHex(const element &e) {
+            const char *digits = "0123456789abcdef";
+            std::string hex;
+            for (size_t bit=0; bit<M; bit+=4) {
+                hex += digits[(e[bit / 64] >> (bit % 64)) & 15];
+            }
+            while (hex.size() > 1 && hex.back() == '0')
+                hex.pop_back();
+            return std::string(hex.rbegin(), hex.rend());
+        }
+};
+
+#endif // LARGE_GALOIS_FIELD_HPP
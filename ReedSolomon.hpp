@@ -0,0 +1,345 @@
+#ifndef REED_SOLOMON_HPP
+#define REED_SOLOMON_HPP
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include "GaloisField.hpp"
+
+enum class generatorMatrix {
+    vandermonde, // V * inverse(top k rows of V), V[i][j] = i^j
+    cauchy       // identity over C[i][j] = 1/(x_i + y_j), x_i = k+i, y_j = j
+};
+
+/**
+ * Systematic Reed-Solomon erasure code over a GaloisField
+ *
+ * k data shards are extended with p parity shards so that any k of the k+p shards recover the rest.
+ * Shards are equal-length buffers of Words, one field element per word: uint8_t for m <= 8, uint16_t for
+ * m <= 16, uint32_t for m <= 32. All buffer work goes through the field's region multiply-accumulate kernels.
+ * The matrix that decodes a given set of surviving shards is computed once and cached.
+ */
+template <typename Word>
+class ReedSolomon {
+    private:
+        GaloisField field;
+        int dataShards;
+        int parityShards;
+        vector<uint64_t> encodeMatrix; // (k+p) x k, row-major; the top k rows are the identity
+        vector<regionMultiplier<Word>> parityMultipliers; // region tables of the p x k parity rows
+
+        static const size_t maxCachedPatterns = 1024;
+        map<vector<int>, vector<uint64_t>> decodeCache; // surviving rows used -> k x k decode matrix
+        mutex cacheLock;
+
+        // Shards are processed in chunks of this many words so the outputs stay in cache across inputs
+        static const size_t chunkWords = 16384 / sizeof(Word);
+
+        const fieldArithmetic& arithmetic() {
+            return field.getArithmetic();
+        }
+
+        // Inverts the n x n row-major matrix in place by Gauss-Jordan elimination; throws runtime_error if singular
+        void invertMatrix(vector<uint64_t> &matrix, int n) {
+            vector<uint64_t> result(n * n, 0);
+            for (int i=0; i<n; i++) {
+                result[i*n + i] = 1;
+            }
+            for (int col=0; col<n; col++) {
+                int pivot = col;
+                while (pivot < n && matrix[pivot*n + col] == 0)
+                    pivot++;
+                if (pivot == n) {
+                    throw runtime_error("Reed-Solomon matrix is singular");
+                }
+                if (pivot != col) {
+                    for (int j=0; j<n; j++) {
+                        swap(matrix[pivot*n + j], matrix[col*n + j]);
+                        swap(result[pivot*n + j], result[col*n + j]);
+                    }
+                }
+                uint64_t scale = arithmetic().inverse(matrix[col*n + col]);
+                for (int j=0; j<n; j++) {
+                    matrix[col*n + j] = arithmetic().multiply(matrix[col*n + j], scale);
+                    result[col*n + j] = arithmetic().multiply(result[col*n + j], scale);
+                }
+                for (int row=0; row<n; row++) {
+                    uint64_t factor = matrix[row*n + col];
+                    if (row == col || factor == 0)
+                        continue;
+                    for (int j=0; j<n; j++) {
+                        matrix[row*n + j] ^= arithmetic().multiply(factor, matrix[col*n + j]);
+                        result[row*n + j] ^= arithmetic().multiply(factor, result[col*n + j]);
+                    }
+                }
+            }
+            matrix = result;
+        }
+
+        void buildEncodeMatrix(generatorMatrix kind) {
+            int k = dataShards, n = dataShards + parityShards;
+            encodeMatrix.assign(n * k, 0);
+            if (kind == generatorMatrix::cauchy) {
+                for (int i=0; i<k; i++) {
+                    encodeMatrix[i*k + i] = 1;
+                }
+                for (int i=k; i<n; i++) {
+                    for (int j=0; j<k; j++) {
+                        encodeMatrix[i*k + j] = arithmetic().inverse((uint64_t)i ^ (uint64_t)j);
+                    }
+                }
+                return;
+            }
+            // Any k rows of a Vandermonde matrix on distinct points are independent, and multiplying by
+            // the inverse of its top square keeps that while making the top rows the identity
+            vector<uint64_t> vandermonde(n * k);
+            for (int i=0; i<n; i++) {
+                for (int j=0; j<k; j++) {
+                    vandermonde[i*k + j] = arithmetic().power(i, j);
+                }
+            }
+            vector<uint64_t> top(vandermonde.begin(), vandermonde.begin() + k*k);
+            invertMatrix(top, k);
+            for (int i=0; i<n; i++) {
+                for (int j=0; j<k; j++) {
+                    uint64_t sum = 0;
+                    for (int t=0; t<k; t++) {
+                        sum ^= arithmetic().multiply(vandermonde[i*k + t], top[t*k + j]);
+                    }
+                    encodeMatrix[i*k + j] = sum;
+                }
+            }
+        }
+
+        vector<regionMultiplier<Word>> makeMultipliers(const uint64_t *rows, size_t count) {
+            vector<regionMultiplier<Word>> multipliers(count);
+            for (size_t i=0; i<count; i++) {
+                multipliers[i] = field.makeRegionMultiplier(basicFieldElement<Word>((Word)rows[i]));
+            }
+            return multipliers;
+        }
+
+        // outputs[r] = sum_j rows[r][j] * inputs[j] over length words; rows has outputs.size() rows of
+        // inputs.size() coefficients, and multipliers their region tables, built once for all the chunks
+        void multiplyShards(const uint64_t *rows, const regionMultiplier<Word> *multipliers, const vector<const Word*> &inputs,
+                            const vector<Word*> &outputs, size_t length) {
+            size_t columns = inputs.size();
+            for (size_t offset=0; offset<length; offset+=chunkWords) {
+                size_t words = min(chunkWords, length - offset);
+                for (size_t r=0; r<outputs.size(); r++) {
+                    Word *dst = outputs[r] + offset;
+                    bool first = true;
+                    for (size_t j=0; j<columns; j++) {
+                        if (rows[r*columns + j] == 0)
+                            continue;
+                        const regionMultiplier<Word> &c = multipliers[r*columns + j];
+                        if (first) {
+                            field.regionMultiply(inputs[j] + offset, dst, words, c);
+                            first = false;
+                        } else {
+                            field.regionMultiplyXor(inputs[j] + offset, dst, words, c);
+                        }
+                    }
+                    if (first) {
+                        fill(dst, dst + words, (Word)0);
+                    }
+                }
+            }
+        }
+
+        void checkShardCount(size_t count) {
+            if (count != (size_t)(dataShards + parityShards)) {
+                throw invalid_argument("Reed-Solomon needs exactly k + p shards");
+            }
+        }
+        void checkShards(const vector<Word*> &shards, size_t length) {
+            checkShardCount(shards.size());
+            for (Word *shard: shards) {
+                if (shard == nullptr && length > 0) {
+                    throw invalid_argument("Reed-Solomon shard buffer is null");
+                }
+            }
+        }
+        static vector<Word*> shardPointers(vector<vector<Word>> &shards) {
+            vector<Word*> pointers;
+            for (auto &shard: shards) {
+                pointers.push_back(shard.data());
+            }
+            return pointers;
+        }
+
+    public:
+        /**
+         * @param gf Field to code over; its elements must fit in Word
+         * @param k Number of data shards
+         * @param p Number of parity shards; k + p may be at most 2^m
+         * @param kind Generator matrix construction
+         */
+        ReedSolomon(const GaloisField &gf, int k, int p, generatorMatrix kind = generatorMatrix::cauchy) : field(gf) {
+            if (field.getDegree() > (int)(8 * sizeof(Word))) {
+                throw invalid_argument("field elements do not fit in the shard word size");
+            }
+            if (k < 1 || p < 0 || (uint64_t)(k + p) > field.size()) {
+                throw invalid_argument("Reed-Solomon needs k >= 1, p >= 0 and k + p <= 2^m shards");
+            }
+            dataShards = k;
+            parityShards = p;
+            buildEncodeMatrix(kind);
+            parityMultipliers = makeMultipliers(&encodeMatrix[k * k], (size_t)p * k);
+        }
+
+        int getDataShards() {
+            return dataShards;
+        }
+        int getParityShards() {
+            return parityShards;
+        }
+        // Row i of the (k+p) x k generator matrix
+        vector<uint64_t> getMatrixRow(int i) {
+            return vector<uint64_t>(encodeMatrix.begin() + i*dataShards, encodeMatrix.begin() + (i+1)*dataShards);
+        }
+
+        /**
+         * Compute the parity shards
+         *
+         * @param shards k + p buffers of length words; the first k hold the data, the last p are overwritten
+         * @throws invalid_argument unless there are k + p shards
+         */
+        void encode(const vector<Word*> &shards, size_t length) {
+            checkShards(shards, length);
+            vector<const Word*> data(shards.begin(), shards.begin() + dataShards);
+            vector<Word*> parity(shards.begin() + dataShards, shards.end());
+            multiplyShards(&encodeMatrix[dataShards * dataShards], parityMultipliers.data(), data, parity, length);
+        }
+
+        // encode over vectors, which must all have the same length
+        void encode(vector<vector<Word>> &shards) {
+            checkShardCount(shards.size());
+            size_t length = shards[0].size();
+            for (auto &shard: shards) {
+                if (shard.size() != length) {
+                    throw invalid_argument("Reed-Solomon shards must all have the same length");
+                }
+            }
+            encode(shardPointers(shards), length);
+        }
+
+        /**
+         * Rebuild missing shards in place
+         *
+         * @param shards k + p buffers of length words
+         * @param present present[i] is true if shards[i] holds valid data; missing shards are rewritten
+         * @return false (and nothing is written) if fewer than k shards are present
+         * @throws invalid_argument unless there are k + p shards and as many present flags
+         */
+        bool reconstruct(const vector<Word*> &shards, const vector<bool> &present, size_t length) {
+            checkShards(shards, length);
+            if (present.size() != shards.size()) {
+                throw invalid_argument("Reed-Solomon needs one present flag per shard");
+            }
+            int k = dataShards, n = dataShards + parityShards;
+            vector<int> rows;
+            for (int i=0; i<n && (int)rows.size()<k; i++) {
+                if (present[i])
+                    rows.push_back(i);
+            }
+            if ((int)rows.size() < k) {
+                return false;
+            }
+
+            vector<Word*> missingData;
+            vector<int> missingDataIndex;
+            for (int i=0; i<k; i++) {
+                if (!present[i]) {
+                    missingData.push_back(shards[i]);
+                    missingDataIndex.push_back(i);
+                }
+            }
+
+            if (!missingData.empty()) {
+                vector<uint64_t> decode;
+                {
+                    lock_guard<mutex> guard(cacheLock);
+                    auto cached = decodeCache.find(rows);
+                    if (cached != decodeCache.end()) {
+                        decode = cached->second;
+                    }
+                }
+                if (decode.empty()) {
+                    decode.resize(k * k);
+                    for (int r=0; r<k; r++) {
+                        for (int j=0; j<k; j++) {
+                            decode[r*k + j] = encodeMatrix[rows[r]*k + j];
+                        }
+                    }
+                    invertMatrix(decode, k);
+                    lock_guard<mutex> guard(cacheLock);
+                    if (decodeCache.size() >= maxCachedPatterns) {
+                        decodeCache.clear();
+                    }
+                    decodeCache[rows] = decode;
+                }
+
+                // Data shard i is row i of the decode matrix applied to the surviving shards
+                vector<uint64_t> selected;
+                for (int i: missingDataIndex) {
+                    selected.insert(selected.end(), decode.begin() + i*k, decode.begin() + (i+1)*k);
+                }
+                vector<const Word*> inputs;
+                for (int r: rows) {
+                    inputs.push_back(shards[r]);
+                }
+                vector<regionMultiplier<Word>> multipliers = makeMultipliers(selected.data(), selected.size());
+                multiplyShards(selected.data(), multipliers.data(), inputs, missingData, length);
+            }
+
+            // Missing parity is re-encoded from the (now complete) data
+            vector<uint64_t> parityRows;
+            vector<regionMultiplier<Word>> multipliers;
+            vector<Word*> missingParity;
+            for (int i=k; i<n; i++) {
+                if (!present[i]) {
+                    parityRows.insert(parityRows.end(), encodeMatrix.begin() + i*k, encodeMatrix.begin() + (i+1)*k);
+                    multipliers.insert(multipliers.end(), parityMultipliers.begin() + (i-k)*k, parityMultipliers.begin() + (i-k+1)*k);
+                    missingParity.push_back(shards[i]);
+                }
+            }
+            if (!missingParity.empty()) {
+                vector<const Word*> data(shards.begin(), shards.begin() + k);
+                multiplyShards(parityRows.data(), multipliers.data(), data, missingParity, length);
+            }
+            return true;
+        }
+
+        /**
+         * reconstruct over vectors: the present shards must all have the same length, and missing ones are
+         * resized to it; with fewer than k present, false and the shards are left as they were
+         */
+        bool reconstruct(vector<vector<Word>> &shards, const vector<bool> &present) {
+            checkShardCount(shards.size());
+            if (present.size() != shards.size()) {
+                throw invalid_argument("Reed-Solomon needs one present flag per shard");
+            }
+            size_t length = 0;
+            int found = 0;
+            for (size_t i=0; i<shards.size(); i++) {
+                if (!present[i])
+                    continue;
+                if (found && shards[i].size() != length) {
+                    throw invalid_argument("Reed-Solomon shards must all have the same length");
+                }
+                length = shards[i].size();
+                found++;
+            }
+            if (found < dataShards) {
+                return false; // before any shard is resized
+            }
+            for (size_t i=0; i<shards.size(); i++) {
+                if (!present[i])
+                    shards[i].resize(length);
+            }
+            return reconstruct(shardPointers(shards), present, length);
+        }
+};
+
+#endif // REED_SOLOMON_HPP
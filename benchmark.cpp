@@ -0,0 +1,853 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <random>
+#include <cstring>
+#include "GaloisField.hpp"
+#include "LargeGaloisField.hpp"
+#include "GFPoly.hpp"
+#include "ReedSolomon.hpp"
+using namespace std;
+
+/*
+Benchmarks for the Galois field arithmetic. Build with optimizations, e.g.
+    g++ -std=c++17 -O2 -I. benchmark.cpp -o benchmark
+
+    ./benchmark          human readable tables
+    ./benchmark --json   one JSON document on stdout, for diffing runs against a saved baseline
+*/
+
+
+struct benchmarkField {
+    int m;
+    uint64_t poly; // defining polynomial without the x^m term
+};
+
+// Irreducible (and for m <= 32 primitive) defining polynomials
+const vector<benchmarkField> benchmarkFields = {
+    {4, 0x3},               // x^4+x+1
+    {8, 0x1D},              // x^8+x^4+x^3+x^2+1
+    {12, 0x53},             // x^12+x^6+x^4+x+1
+    {16, 0x100B},           // x^16+x^12+x^3+x+1
+    {24, 0x1B},             // x^24+x^4+x^3+x+1
+    {32, 0x400007},         // x^32+x^22+x^2+x+1
+    {48, 0x18000003},       // x^48+x^28+x^27+x+1
+    {64, 0x1B},             // x^64+x^4+x^3+x+1
+};
+
+vector<uint64_t> randomNonzeroValues(int m, size_t count) {
+    mt19937_64 rng(12345);
+    uint64_t mask = (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+    vector<uint64_t> values(count);
+    for (auto &v: values) {
+        do {
+            v = rng() & mask;
+        } while (v == 0);
+    }
+    return values;
+}
+
+// Average nanoseconds per inversion; the running XOR keeps the calls from being optimized away
+template <typename Invert>
+double timeInversion(const vector<uint64_t> &values, Invert invert, uint64_t &sink) {
+    const int rounds = 5;
+    auto start = chrono::steady_clock::now();
+    for (int r=0; r<rounds; r++) {
+        for (auto v: values) {
+            sink ^= invert(v);
+        }
+    }
+    auto stop = chrono::steady_clock::now();
+    return chrono::duration<double, nano>(stop - start).count() / (rounds * values.size());
+}
+
+struct benchmarkResult {
+    string operation;
+    int m;
+    double nsPerOp;
+    double cyclesPerOp; // time stamp counter ticks, 0 where there is no counter
+    double bytesPerSecond; // 0 for scalar operations
+};
+
+// Results are folded into this so the timed calls are not optimized away
+volatile uint64_t benchmarkSink;
+
+static inline uint64_t readCycleCounter() {
+#if GALOIS_X86
+    return __rdtsc();
+#else
+    return 0;
+#endif
+}
+
+/*
+    Times batch(), which performs opsPerBatch operations over bytesPerBatch bytes. Batches are repeated until
+    a run lasts at least minimumSeconds, and the fastest of three runs is reported.
+*/
+template <typename Batch>
+benchmarkResult measure(const string &operation, int m, Batch batch, size_t opsPerBatch, size_t bytesPerBatch = 0) {
+    const double minimumSeconds = 0.05;
+    double bestNs = 0, bestCycles = 0;
+    for (int run=0; run<3; run++) {
+        size_t batches = 0;
+        uint64_t cycleStart = readCycleCounter();
+        auto start = chrono::steady_clock::now();
+        double elapsed;
+        do {
+            batch();
+            batches++;
+            elapsed = chrono::duration<double>(chrono::steady_clock::now() - start).count();
+        } while (elapsed < minimumSeconds);
+        uint64_t cycles = readCycleCounter() - cycleStart;
+        double ns = elapsed * 1e9 / (batches * opsPerBatch);
+        if (run == 0 || ns < bestNs) {
+            bestNs = ns;
+            bestCycles = (double)cycles / (batches * opsPerBatch);
+        }
+    }
+    double bytesPerSecond = bytesPerBatch ? bytesPerBatch / (bestNs * opsPerBatch) * 1e9 : 0;
+    return {operation, m, bestNs, bestCycles, bytesPerSecond};
+}
+
+// Times dst = c*src and dst ^= c*src over a 64 KiB buffer of Words, per element; 64-bit fields have no region operations
+template <typename Word>
+void measureRegion(vector<benchmarkResult> &results, GaloisField &field, int m, const vector<uint64_t> &values) {
+    const size_t words = (1 << 16) / sizeof(Word);
+    vector<Word> src(words), dst(words);
+    for (size_t i=0; i<words; i++) {
+        src[i] = (Word)values[i % values.size()];
+    }
+    Word c = (Word)values[0];
+    results.push_back(measure("regionMultiply", m, [&]() { field.regionMultiply(src.data(), dst.data(), words, c); }, words, words * sizeof(Word)));
+    results.push_back(measure("regionMultiplyXor", m, [&]() { field.regionMultiplyXor(src.data(), dst.data(), words, c); }, words, words * sizeof(Word)));
+}
+
+vector<benchmarkResult> benchmarkOperations() {
+    vector<benchmarkResult> results;
+    uint64_t sink = 0;
+    for (auto &f: benchmarkFields) {
+        const size_t count = 1 << 12;
+        auto values = randomNonzeroValues(f.m, count + 1);
+        fieldArithmetic arithmetic(f.m, f.poly);
+
+        results.push_back(measure("add", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= values[i] ^ values[i+1];
+        }, count));
+        results.push_back(measure("multiply", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.multiply(values[i], values[i+1]);
+        }, count));
+        results.push_back(measure("square", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.square(values[i]);
+        }, count));
+        results.push_back(measure("sqrt", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.sqrt(values[i]);
+        }, count));
+        results.push_back(measure("divide", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.divide(values[i], values[i+1]);
+        }, count));
+        results.push_back(measure("inverse", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.inverse(values[i]);
+        }, count));
+        results.push_back(measure("power", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.power(values[i], (long long)(values[i+1] >> 1));
+        }, count));
+
+        results.push_back(measure("trace", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.trace(values[i]);
+        }, count));
+        results.push_back(measure("solveQuadratic", f.m, [&]() {
+            uint64_t z = 0;
+            for (size_t i=0; i<count; i++)
+                sink ^= arithmetic.solveQuadratic(values[i], z) ? z : 1;
+        }, count));
+
+        fixedBasePower comb(arithmetic, values[count]);
+        results.push_back(measure("fixedBasePower", f.m, [&]() {
+            for (size_t i=0; i<count; i++)
+                sink ^= comb.power(values[i]);
+        }, count));
+
+        GaloisField field(f.m, f.poly);
+        vector<fieldElement> batch(values.begin(), values.begin() + count);
+        results.push_back(measure("batchInverse", f.m, [&]() {
+            field.batchInverse(batch);
+        }, count));
+        sink ^= batch[0].getValue();
+
+        if (f.m <= 8) {
+            measureRegion<uint8_t>(results, field, f.m, values);
+        } else if (f.m <= 16) {
+            measureRegion<uint16_t>(results, field, f.m, values);
+        } else if (f.m <= 32) {
+            measureRegion<uint32_t>(results, field, f.m, values);
+        }
+
+        // Construction includes the generator search and tables for m <= 16
+        results.push_back(measure("construct", f.m, [&]() {
+            GaloisField constructed(f.m, f.poly);
+            sink ^= constructed.getDegree();
+        }, 1));
+    }
+    benchmarkSink = sink;
+    return results;
+}
+
+// GF(2)[x] gcd of random polynomials; m is the operand size in bits. "euclid" is the gcd from the
+// extended Euclid, the reference for the binary "gcd" at one word.
+void benchmarkPolynomials(vector<benchmarkResult> &results) {
+    uint64_t sink = 0;
+    const size_t count = 1 << 10;
+    auto values = randomNonzeroValues(64, count + 1);
+    results.push_back(measure("gcd", 64, [&]() {
+        for (size_t i=0; i<count; i++)
+            sink ^= polynomialGCD(values[i], values[i+1]);
+    }, count));
+    results.push_back(measure("euclid", 64, [&]() {
+        for (size_t i=0; i<count; i++)
+            sink ^= polynomialExtendedGCD(values[i], values[i+1]).gcd;
+    }, count));
+    for (size_t words: {4, 16, 64}) {
+        vector<uint64_t> a(values.begin(), values.begin() + words), b(values.begin() + words, values.begin() + 2*words);
+        results.push_back(measure("gcd", (int)(64 * words), [&]() {
+            sink ^= polynomialGCD(a, b)[0];
+        }, 1));
+    }
+    // Products run through clmulMultiply: schoolbook, Karatsuba or Toom-3 by size
+    mt19937_64 rng(12345);
+    for (size_t words: {4, 64, 512, 4096}) {
+        vector<uint64_t> a(words), b(words);
+        for (size_t i=0; i<words; i++) {
+            a[i] = rng();
+            b[i] = rng();
+        }
+        results.push_back(measure("polyMultiply", (int)(64 * words), [&]() {
+            sink ^= polynomialMultiply(a, b)[words];
+        }, 1));
+    }
+    benchmarkSink = sink;
+}
+
+// Evaluation at n points of GF(2^16), per point: the additive FFT against Horner's rule at each point
+void benchmarkAdditiveFFT(vector<benchmarkResult> &results) {
+    GaloisField field(16, 0x1002B);
+    AdditiveFFT fft(field);
+    uint64_t sink = 0;
+    mt19937_64 rng(12345);
+    for (int logN: {10, 14}) {
+        size_t n = (size_t)1 << logN;
+        vector<uint64_t> data(n);
+        for (auto &d: data) {
+            d = rng() & 0xFFFF;
+        }
+        GFPoly p(field, data);
+        results.push_back(measure("fft " + to_string(n), 16, [&]() {
+            fft.fft(data.data(), logN);
+        }, n));
+        results.push_back(measure("ifft " + to_string(n), 16, [&]() {
+            fft.ifft(data.data(), logN);
+        }, n));
+        results.push_back(measure("horner " + to_string(n), 16, [&]() {
+            for (size_t x=0; x<n; x+=n/64)
+                sink ^= p.evaluate(x);
+        }, 64));
+    }
+    benchmarkSink = sink;
+}
+
+// Multi-limb fields over the moduli GaloisField(m) would pick, m = 163 ... 571 as in the NIST binary curves
+template <unsigned M>
+void benchmarkLargeField(vector<benchmarkResult> &results) {
+    LargeGaloisField<M> field;
+    typedef typename LargeGaloisField<M>::element element;
+    mt19937_64 rng(12345);
+    element a, b;
+    for (size_t i=0; i<field.limbs; i++) {
+        a[i] = rng();
+        b[i] = rng();
+    }
+    a[field.limbs - 1] &= ~0ULL >> (64 * field.limbs - M);
+    b[field.limbs - 1] &= ~0ULL >> (64 * field.limbs - M);
+    const size_t count = 256;
+    results.push_back(measure("multiply", M, [&]() {
+        for (size_t i=0; i<count; i++)
+            a = field.multiply(a, b);
+    }, count));
+    results.push_back(measure("square", M, [&]() {
+        for (size_t i=0; i<count; i++)
+            a = field.square(a);
+    }, count));
+    results.push_back(measure("inverse", M, [&]() {
+        a = field.inverse(a);
+    }, 1));
+    benchmarkSink = a[0];
+}
+
+void benchmarkLargeFields(vector<benchmarkResult> &results) {
+    benchmarkLargeField<163>(results);
+    benchmarkLargeField<233>(results);
+    benchmarkLargeField<283>(results);
+    benchmarkLargeField<409>(results);
+    benchmarkLargeField<571>(results);
+}
+
+void printResults(const vector<benchmarkResult> &results) {
+    cout << "Operations" << endl;
+    cout << setw(20) << "operation" << setw(8) << "m" << setw(14) << "ns/op" << setw(14) << "cycles/op" << setw(10) << "GB/s" << endl;
+    for (auto &r: results) {
+        cout << setw(20) << r.operation << setw(8) << r.m;
+        cout << setw(14) << fixed << setprecision(2) << r.nsPerOp << setw(14) << r.cyclesPerOp;
+        if (r.bytesPerSecond > 0) {
+            cout << setw(10) << r.bytesPerSecond / 1e9;
+        }
+        cout << "\n";
+    }
+    cout << endl;
+}
+
+void printJson(const vector<benchmarkResult> &results) {
+    cout << "{\n  \"benchmarks\": [\n";
+    for (size_t i=0; i<results.size(); i++) {
+        auto &r = results[i];
+        cout << "    {\"operation\": \"" << r.operation << "\", \"m\": " << r.m << setprecision(4) << fixed
+             << ", \"ns_per_op\": " << r.nsPerOp << ", \"cycles_per_op\": " << r.cyclesPerOp
+             << ", \"bytes_per_second\": " << setprecision(0) << r.bytesPerSecond << "}" << (i + 1 < results.size() ? "," : "") << "\n";
+    }
+    cout << "  ]\n}" << endl;
+}
+
+void benchmarkInversion() {
+    cout << "Inversion (ns/op)" << endl;
+    cout << setw(4) << "m" << setw(12) << "table" << setw(12) << "itoh-tsujii" << setw(12) << "euclid" << setw(13) << "selected" << endl;
+    uint64_t sink = 0;
+    for (auto &f: benchmarkFields) {
+        fieldArithmetic field(f.m, f.poly);
+        auto values = randomNonzeroValues(f.m, 1 << 16);
+
+        // Check the three methods agree before timing them
+        for (size_t i=0; i<1000; i++) {
+            uint64_t e = field.inverseEuclid(values[i]);
+            if (field.inverseItohTsujii(values[i]) != e || field.inverseTable(values[i]) != e || field.multiply(e, values[i]) != 1) {
+                cout << "Inversion mismatch in GF(2^" << f.m << ") for " << values[i] << endl;
+                return;
+            }
+        }
+
+        cout << setw(4) << f.m;
+        if (field.getTables()) {
+            cout << setw(12) << fixed << setprecision(1) << timeInversion(values, [&](uint64_t v) { return field.inverseTable(v); }, sink);
+        } else {
+            cout << setw(12) << "-";
+        }
+        cout << setw(12) << fixed << setprecision(1) << timeInversion(values, [&](uint64_t v) { return field.inverseItohTsujii(v); }, sink);
+        cout << setw(12) << fixed << setprecision(1) << timeInversion(values, [&](uint64_t v) { return field.inverseEuclid(v); }, sink);
+        const char *names[] = {"table", "itoh-tsujii", "euclid"};
+        cout << setw(13) << names[(int)field.getInversionMethod()] << endl;
+    }
+    cout << "(checksum " << sink << ")" << endl;
+}
+
+/*
+    Encodes random data, erases up to p random shards, reconstructs and compares, for each shard word size and
+    generator; false (after reporting on stderr) on a mismatch. Run before the timings, as they assume it.
+*/
+template <typename Word>
+bool checkReedSolomon(GaloisField field, generatorMatrix kind, mt19937_64 &rng) {
+    const int k = 10, p = 4;
+    const size_t length = 40000; // several chunks
+    ReedSolomon<Word> rs(field, k, p, kind);
+    uint64_t mask = (1ULL << field.getDegree()) - 1;
+    vector<vector<Word>> shards(k + p, vector<Word>(length));
+    for (int i=0; i<k; i++) {
+        for (auto &w: shards[i]) {
+            w = (Word)(rng() & mask);
+        }
+    }
+    rs.encode(shards);
+    for (int trial=0; trial<20; trial++) {
+        vector<vector<Word>> damaged = shards;
+        vector<bool> present(k + p, true);
+        int erasures = (int)(rng() % (p + 1));
+        for (int e=0; e<erasures; e++) {
+            int i = (int)(rng() % (k + p));
+            present[i] = false;
+            damaged[i].assign(length / 2, (Word)0x5A); // wrong length and contents, rebuilt regardless
+        }
+        if (!rs.reconstruct(damaged, present) || damaged != shards) {
+            cerr << "Reed-Solomon round trip mismatch in GF(2^" << field.getDegree() << ") with " << 8 * sizeof(Word) << "-bit shards\n";
+            return false;
+        }
+    }
+    vector<bool> tooFew(k + p, false);
+    tooFew[0] = true;
+    vector<vector<Word>> untouched = shards;
+    if (rs.reconstruct(untouched, tooFew) || untouched != shards) {
+        cerr << "Reed-Solomon reconstructed from too few shards, or changed them\n";
+        return false;
+    }
+    return true;
+}
+
+bool checkReedSolomon() {
+    mt19937_64 rng(12345);
+    bool ok = true;
+    for (generatorMatrix kind: {generatorMatrix::cauchy, generatorMatrix::vandermonde}) {
+        ok = checkReedSolomon<uint8_t>(GaloisField(8, 0x11D), kind, rng) && ok;
+        ok = checkReedSolomon<uint16_t>(GaloisField(16, 0x1002B), kind, rng) && ok;
+        ok = checkReedSolomon<uint32_t>(GaloisField(32, 0x10000008DULL), kind, rng) && ok;
+    }
+    return ok;
+}
+
+/*
+    GFPoly against references computed here: products against a plain double loop at lengths either side of
+    the Karatsuba and FFT thresholds, divmod by reconstructing the dividend, and gcd of multiples of a common factor.
+*/
+bool checkPolynomials(GaloisField field, mt19937_64 &rng) {
+    const fieldArithmetic &arithmetic = field.getArithmetic();
+    int m = field.getDegree();
+    uint64_t mask = (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+    auto randomPoly = [&](size_t n) {
+        vector<uint64_t> c(n);
+        for (auto &x: c) {
+            x = rng() & mask;
+        }
+        if (n > 0 && c.back() == 0) {
+            c.back() = 1;
+        }
+        return GFPoly(field, c);
+    };
+    auto fail = [&](const string &what) {
+        cerr << "GFPoly " << what << " mismatch in GF(2^" << m << ")\n";
+        return false;
+    };
+    const size_t t = GFPoly::karatsubaThreshold, f = GFPoly::fftThreshold;
+    for (size_t n: {(size_t)1, t - 1, t, t + 1, 5 * t, f - 1, f, f + 100}) {
+        GFPoly a = randomPoly(n), b = randomPoly(n + 3);
+        vector<uint64_t> expected(2 * n + 2, 0);
+        for (size_t i=0; i<n; i++) {
+            for (size_t j=0; j<n+3; j++) {
+                expected[i+j] ^= arithmetic.multiply(a[i], b[j]);
+            }
+        }
+        if (a * b != GFPoly(field, expected) || b * a != GFPoly(field, expected)) {
+            return fail("product of length " + to_string(n));
+        }
+    }
+    for (size_t n: {(size_t)1, (size_t)7, (size_t)40}) {
+        GFPoly a = randomPoly(3 * n), b = randomPoly(n);
+        auto [q, r] = a.divmod(b);
+        if (q * b + r != a || r.degree() >= b.degree()) {
+            return fail("divmod");
+        }
+        GFPoly c = randomPoly(n + 1), d = randomPoly(2 * n);
+        GFPoly g = GFPoly::gcd(a, d);
+        if (!(a % g).isZero() || !(d % g).isZero() || GFPoly::gcd(a * c, d * c) != (g * c).monic()) {
+            return fail("gcd");
+        }
+    }
+    return true;
+}
+
+bool checkPolynomials() {
+    mt19937_64 rng(12345);
+    bool ok = checkPolynomials(GaloisField(8, 0x11D), rng);
+    ok = checkPolynomials(GaloisField(16, 0x1002B), rng) && ok;
+    return checkPolynomials(GaloisField(64), rng) && ok;
+}
+
+/*
+    AdditiveFFT round trips, fft/ifft on shifted cosets and toNovelBasis/fromNovelBasis, and evaluate against
+    Horner's rule so the round trips are not just two wrong maps inverting each other.
+*/
+bool checkAdditiveFFT(GaloisField field, int maxLog, mt19937_64 &rng) {
+    AdditiveFFT fft(field);
+    int m = field.getDegree();
+    uint64_t mask = (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+    for (int logN=0; logN<=maxLog; logN++) {
+        size_t n = (size_t)1 << logN;
+        vector<uint64_t> p(n);
+        for (auto &c: p) {
+            c = rng() & mask;
+        }
+        uint64_t shift = (logN < m) ? ((rng() & mask) >> logN << logN) : 0;
+        vector<uint64_t> data = p;
+        fft.fft(data.data(), logN, shift);
+        fft.ifft(data.data(), logN, shift);
+        bool ok = (data == p);
+        fft.toNovelBasis(data.data(), logN);
+        fft.fromNovelBasis(data.data(), logN);
+        ok = ok && (data == p);
+        vector<uint64_t> values = fft.evaluate(p, logN, shift);
+        GFPoly poly(field, p);
+        for (size_t i=0; ok && i<n; i+=1+n/16) {
+            ok = (values[i] == poly.evaluate(shift ^ i));
+        }
+        if (!ok || fft.interpolate(values, shift) != p) {
+            cerr << "AdditiveFFT mismatch in GF(2^" << m << ") at " << n << " points\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkAdditiveFFT() {
+    mt19937_64 rng(12345);
+    bool ok = checkAdditiveFFT(GaloisField(8, 0x11D), 8, rng);
+    ok = checkAdditiveFFT(GaloisField(16, 0x1002B), 12, rng) && ok;
+    return checkAdditiveFFT(GaloisField(32, 0x10000008DULL), 10, rng) && ok;
+}
+
+/*
+    LargeGaloisField identities on random elements: a * a^-1 = 1, a^2 = a*a, a(b + c) = ab + ac, and
+    a^(2^M) = a, which holds only if the products are reduced by an irreducible modulus correctly.
+*/
+template <unsigned M>
+bool checkLargeField(mt19937_64 &rng) {
+    LargeGaloisField<M> field;
+    typedef typename LargeGaloisField<M>::element element;
+    auto randomElement = [&]() {
+        element e;
+        for (size_t i=0; i<field.limbs; i++) {
+            e[i] = rng();
+        }
+        e[field.limbs - 1] &= ~0ULL >> (64 * field.limbs - M);
+        return e;
+    };
+    for (int trial=0; trial<20; trial++) {
+        element a = randomElement(), b = randomElement(), c = randomElement();
+        if (field.isZero(a)) {
+            continue;
+        }
+        bool ok = field.multiply(a, field.inverse(a)) == field.one()
+            && field.square(a) == field.multiply(a, a)
+            && field.multiply(a, field.add(b, c)) == field.add(field.multiply(a, b), field.multiply(a, c))
+            && field.frobenius(a, M) == a;
+        if (!ok) {
+            cerr << "LargeGaloisField<" << M << "> mismatch for a = " << field.toHex(a) << "\n";
+            return false;
+        }
+    }
+    return true;
+}
+
+bool checkLargeFields() {
+    mt19937_64 rng(12345);
+    bool ok = checkLargeField<163>(rng);
+    ok = checkLargeField<233>(rng) && ok;
+    ok = checkLargeField<409>(rng) && ok;
+    return checkLargeField<571>(rng) && ok;
+}
+
+// batchInverse and batchInverseParallel over every benchmark field: a * a^-1 = 1 by the bit-serial product,
+// with zeros (which stay 0) mixed in
+bool checkBatchInverse() {
+    for (auto &f: benchmarkFields) {
+        GaloisField field(f.m, f.poly);
+        const fieldArithmetic &arithmetic = field.getArithmetic();
+        auto values = randomNonzeroValues(f.m, 3 * 4096 + 5);
+        for (size_t i=0; i<values.size(); i+=97) {
+            values[i] = 0;
+        }
+        vector<fieldElement> serial, parallel;
+        for (uint64_t v: values) {
+            serial.push_back(fieldElement(v));
+        }
+        parallel = serial;
+        field.batchInverse(serial);
+        field.batchInverseParallel(parallel.data(), parallel.size(), 3);
+        for (size_t i=0; i<values.size(); i++) {
+            uint64_t expected = values[i] ? 1 : 0;
+            if (arithmetic.shiftAndAddMultiply(values[i], serial[i].getValue()) != expected
+                || arithmetic.shiftAndAddMultiply(values[i], parallel[i].getValue()) != expected) {
+                cerr << "batchInverse mismatch in GF(2^" << f.m << ") for " << values[i] << "\n";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/*
+    The shift-and-XOR folds for trinomial and pentanomial moduli against Barrett and the bit-serial product,
+    with both carry-less products (PCLMULQDQ only where the CPU has it) and for squares as well as products
+*/
+bool checkSparseReduction() {
+    struct sparseField {
+        int m;
+        uint64_t poly;
+        reductionMethod shape;
+    };
+    const sparseField fields[] = {
+        {31, 0x9, reductionMethod::trinomial},     // x^31+x^3+1
+        {63, 0x3, reductionMethod::trinomial},     // x^63+x+1
+        {24, 0x1B, reductionMethod::pentanomial},  // x^24+x^4+x^3+x+1
+        {64, 0x1B, reductionMethod::pentanomial},  // x^64+x^4+x^3+x+1
+    };
+    for (auto &f: fields) {
+        auto values = randomNonzeroValues(f.m, 2001);
+        for (multiplyMethod product: {multiplyMethod::clmulHardware, multiplyMethod::clmulPortable}) {
+            fieldArithmetic arithmetic(f.m, f.poly);
+            arithmetic.setMultiplyMethod(product);
+            if (arithmetic.getMultiplyMethod() != product) {
+                continue; // no PCLMULQDQ
+            }
+            for (reductionMethod reducer: {reductionMethod::barrett, f.shape}) {
+                arithmetic.setReductionMethod(reducer);
+                if (arithmetic.getReductionMethod() != reducer) {
+                    cerr << "GF(2^" << f.m << ") does not accept its sparse reduction\n";
+                    return false;
+                }
+                for (size_t i=0; i+1<values.size(); i++) {
+                    uint64_t a = values[i], b = values[i+1];
+                    if (arithmetic.multiply(a, b) != arithmetic.shiftAndAddMultiply(a, b)
+                        || arithmetic.square(a) != arithmetic.shiftAndAddMultiply(a, a)) {
+                        cerr << "Reduction mismatch in GF(2^" << f.m << ") for " << a << " * " << b << "\n";
+                        return false;
+                    }
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/*
+    clmulMultiply against clmulSchoolbook (and the portable schoolbook against both) for random operands: every
+    size to 40 words and either side of the thresholds in effect, then with thresholds forced low so Karatsuba
+    and Toom-3 recurse through odd sizes too. The thresholds are restored afterwards.
+*/
+bool checkClmulMultiply() {
+    mt19937_64 rng(12345);
+    clmulThresholds saved = clmulTuning();
+    const clmulThresholds settings[] = {saved, {2, toom3Minimum}, {3, 9}};
+    for (const clmulThresholds &thresholds: settings) {
+        clmulTuning() = thresholds;
+        vector<size_t> sizes;
+        for (size_t n=1; n<=40; n++) {
+            sizes.push_back(n);
+        }
+        for (size_t t: {thresholds.karatsuba, thresholds.toom3}) {
+            sizes.insert(sizes.end(), {t - 1, t, t + 1, 2 * t + 1});
+        }
+        for (size_t n: sizes) {
+            if (n == 0 || n > 1100)
+                continue;
+            vector<uint64_t> a(n), b(n), out(2 * n), expected(2 * n), portable(2 * n), scratch(clmulScratch(n));
+            for (size_t i=0; i<n; i++) {
+                a[i] = rng();
+                b[i] = rng();
+            }
+            clmulMultiply(a.data(), b.data(), n, out.data(), scratch.data());
+            clmulSchoolbook(a.data(), b.data(), n, expected.data());
+            clmulSchoolbookPortable(a.data(), b.data(), n, portable.data());
+            if (out != expected || portable != expected) {
+                cerr << "clmulMultiply mismatch at " << n << " words (Karatsuba from " << thresholds.karatsuba << ", Toom-3 from " << thresholds.toom3 << ")\n";
+                clmulTuning() = saved;
+                return false;
+            }
+        }
+    }
+    clmulTuning() = saved;
+    return true;
+}
+
+/*
+    square, sqrt and frobenius over every benchmark field and product method, against squarings by the bit-serial
+    product: a^2 = a*a, sqrt(a^2) = sqrt(a)^2 = a, and a^(2^k) for every k up to m, tabulated or not
+*/
+bool checkSquaring() {
+    for (auto &f: benchmarkFields) {
+        auto values = randomNonzeroValues(f.m, 200);
+        values[0] = 0;
+        for (multiplyMethod method: {multiplyMethod::table, multiplyMethod::clmulHardware, multiplyMethod::clmulPortable, multiplyMethod::shiftAndAdd}) {
+            fieldArithmetic arithmetic(f.m, f.poly);
+            arithmetic.setMultiplyMethod(method);
+            if (arithmetic.getMultiplyMethod() != method) {
+                continue;
+            }
+            auto fail = [&](const string &what, uint64_t a) {
+                cerr << what << " mismatch in GF(2^" << f.m << ") for " << a << "\n";
+                return false;
+            };
+            for (uint64_t a: values) {
+                uint64_t square = arithmetic.shiftAndAddMultiply(a, a);
+                if (arithmetic.square(a) != square) {
+                    return fail("square", a);
+                }
+                if (arithmetic.sqrt(square) != a || arithmetic.shiftAndAddMultiply(arithmetic.sqrt(a), arithmetic.sqrt(a)) != a) {
+                    return fail("sqrt", a);
+                }
+            }
+            for (uint64_t a: {values[1], values[2]}) {
+                uint64_t expected = a; // a^(2^k)
+                for (int k=0; k<=f.m; k++) {
+                    if (arithmetic.frobenius(a, k) != expected || (k % 5 == 3 && arithmetic.frobeniusMap(k).apply(a) != expected)) {
+                        return fail("frobenius " + to_string(k), a);
+                    }
+                    expected = arithmetic.shiftAndAddMultiply(expected, expected);
+                }
+            }
+        }
+    }
+    return true;
+}
+
+/*
+    powerUnsigned, power and fixedBasePower against powers by repeated shiftAndAddMultiply: every exponent up to
+    70 one product at a time, then random 64-bit and negative exponents by a bit-serial square-and-multiply
+*/
+bool checkPowers() {
+    mt19937_64 rng(11);
+    for (auto &f: benchmarkFields) {
+        fieldArithmetic arithmetic(f.m, f.poly);
+        auto reference = [&](uint64_t a, uint64_t exponent) {
+            uint64_t result = 1;
+            for (; exponent > 0; exponent >>= 1) {
+                if (exponent & 1)
+                    result = arithmetic.shiftAndAddMultiply(result, a);
+                a = arithmetic.shiftAndAddMultiply(a, a);
+            }
+            return result;
+        };
+        auto fail = [&](const string &what, uint64_t a, uint64_t exponent) {
+            cerr << what << " mismatch in GF(2^" << f.m << ") for " << a << "^" << exponent << "\n";
+            return false;
+        };
+        vector<uint64_t> exponents;
+        for (int i=0; i<40; i++) {
+            exponents.push_back(rng());
+        }
+        exponents.push_back(~0ULL);
+        exponents.push_back((f.m >= 64) ? ~0ULL : (1ULL << f.m) - 1);
+        for (uint64_t a: randomNonzeroValues(f.m, 8)) {
+            vector<fixedBasePower> combs;
+            for (int teeth: {1, 3, 8, 16}) {
+                combs.emplace_back(arithmetic, a, teeth);
+            }
+            uint64_t expected = 1;
+            for (uint64_t e=0; e<=70; e++) {
+                if (arithmetic.powerUnsigned(a, e) != expected || arithmetic.power(a, (long long)e) != expected) {
+                    return fail("power", a, e);
+                }
+                for (auto &comb: combs) {
+                    if (comb.power(e) != expected) {
+                        return fail("fixedBasePower", a, e);
+                    }
+                }
+                expected = arithmetic.shiftAndAddMultiply(expected, a);
+            }
+            for (uint64_t e: exponents) {
+                expected = reference(a, e);
+                if (arithmetic.powerUnsigned(a, e) != expected || combs[2].power(e) != expected || combs[3].power(e) != expected) {
+                    return fail("power", a, e);
+                }
+                // a^-e * a^e = 1
+                long long exponent = (long long)(e >> 1);
+                if (arithmetic.shiftAndAddMultiply(arithmetic.power(a, -exponent), reference(a, (uint64_t)exponent)) != 1) {
+                    return fail("negative power", a, e >> 1);
+                }
+            }
+        }
+        if (arithmetic.powerUnsigned(0, 0) != 1 || arithmetic.powerUnsigned(0, 5) != 0 || fixedBasePower(arithmetic, 0).power(5) != 0) {
+            return fail("zero power", 0, 5);
+        }
+    }
+    return true;
+}
+
+/*
+    trace as the sum of the a^(2^i) by bit-serial squarings, halfTrace h of c in odd m as h^2 + h = c + Tr(c),
+    and solveQuadratic: a root z with z^2 + z = c exactly when Tr(c) = 0, and a*z^2 + b*z + c = 0 for every
+    root of the general form
+*/
+bool checkQuadratics() {
+    for (auto &f: benchmarkFields) {
+        fieldArithmetic arithmetic(f.m, f.poly);
+        auto fail = [&](const string &what, uint64_t c) {
+            cerr << what << " mismatch in GF(2^" << f.m << ") for " << c << "\n";
+            return false;
+        };
+        auto values = randomNonzeroValues(f.m, 200);
+        values[0] = 0;
+        for (size_t i=0; i<values.size(); i++) {
+            uint64_t c = values[i];
+            uint64_t sum = 0, power = c;
+            for (int k=0; k<f.m; k++) {
+                sum ^= power;
+                power = arithmetic.shiftAndAddMultiply(power, power);
+            }
+            if (sum > 1 || arithmetic.trace(c) != (int)sum) {
+                return fail("trace", c);
+            }
+            if (f.m % 2) {
+                uint64_t h = arithmetic.halfTrace(c);
+                if ((arithmetic.shiftAndAddMultiply(h, h) ^ h) != (c ^ sum)) {
+                    return fail("halfTrace", c);
+                }
+            }
+            uint64_t z = 0;
+            bool solved = arithmetic.solveQuadratic(c, z);
+            if (solved != (sum == 0) || (solved && (arithmetic.shiftAndAddMultiply(z, z) ^ z) != c)) {
+                return fail("solveQuadratic", c);
+            }
+
+            uint64_t a = values[(i + 1) % values.size()], b = values[(i + 2) % values.size()];
+            if (a == 0 && b == 0) {
+                continue;
+            }
+            uint64_t roots[2];
+            int count = arithmetic.solveQuadratic(a, b, c, roots);
+            for (int r=0; r<count; r++) {
+                uint64_t y = roots[r];
+                if ((arithmetic.shiftAndAddMultiply(a, arithmetic.shiftAndAddMultiply(y, y)) ^ arithmetic.shiftAndAddMultiply(b, y) ^ c) != 0) {
+                    return fail("solveQuadratic root", c);
+                }
+            }
+            // With a, b != 0 there are no roots only when a*c/b^2 has trace 1
+            if (count == 0 && (a == 0 || b == 0 || arithmetic.trace(arithmetic.divide(arithmetic.shiftAndAddMultiply(a, c), arithmetic.square(b))) != 1)) {
+                return fail("solveQuadratic count", c);
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char *argv[]) {
+    bool json = (argc > 1 && strcmp(argv[1], "--json") == 0);
+    bool checked = checkReedSolomon()
+        && checkPolynomials()
+        && checkAdditiveFFT()
+        && checkLargeFields()
+        && checkBatchInverse()
+        && checkSparseReduction()
+        && checkClmulMultiply()
+        && checkSquaring()
+        && checkPowers()
+        && checkQuadratics();
+    if (!checked) {
+        return 1;
+    }
+    clmulThresholds thresholds = tuneClmulThresholds();
+    if (!json) {
+        cout << "Carry-less multiply thresholds (words): Karatsuba " << thresholds.karatsuba << ", Toom-3 " << thresholds.toom3 << "\n" << endl;
+    }
+    auto results = benchmarkOperations();
+    benchmarkPolynomials(results);
+    benchmarkAdditiveFFT(results);
+    benchmarkLargeFields(results);
+    if (json) {
+        printJson(results);
+        return 0;
+    }
+    printResults(results);
+    benchmarkInversion();
+    return 0;
+}
@@ -0,0 +1,347 @@
+#ifndef BINARY_POLYNOMIAL_HPP
+#define BINARY_POLYNOMIAL_HPP
+
+#include <cstdint>
+#include <ostream>
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "primeFactors.hpp"
+#include "carrylessMultiply.hpp"
+
+/*
+    Word-level polynomials over GF(2): bit i of a uint64_t is the coefficient of x^i. Everything works in
+    registers, using the leading zero count for degrees, with no allocation.
+*/
+
+// Degree of p, -1 for the zero polynomial
+inline int polynomialDegree(uint64_t p) {
+    return p ? 63 - __builtin_clzll(p) : -1;
+}
+
+/**
+ * gcd(a, b) in GF(2)[x], binary (Stein) style
+ *
+ * The common power of x is taken out with a trailing zero count. After that u has a constant term, so
+ * gcd(u, v) = gcd(u, v/x^k) = gcd(u, u+v): each step strips v's factors of x and cancels its constant term
+ * against u, keeping u the lower degree of the two. gcd(0, b) = b.
+ */
+inline uint64_t polynomialGCD(uint64_t u, uint64_t v) {
+    if (u == 0 || v == 0) {
+        return u | v;
+    }
+    int shift = __builtin_ctzll(u | v);
+    u >>= __builtin_ctzll(u);
+    while (true) {
+        v >>= __builtin_ctzll(v);
+        // Integer order agrees with degree order where it matters: a higher degree is a larger integer.
+        // min/max rather than a swap so the unpredictable comparison becomes conditional moves
+        uint64_t low = std::min(u, v), high = std::max(u, v);
+        u = low;
+        v = high ^ low;
+        if (v == 0) {
+            return u << shift;
+        }
+    }
+}
+
+/*
+    Multi-word polynomials: word i holds the coefficients of x^(64i) .. x^(64i+63), trailing zero words
+    are allowed. Used for moduli and products that do not fit in one word.
+*/
+
+// Degree of p, -1 for the zero polynomial
+inline long polynomialDegree(const std::vector<uint64_t> &p) {
+    for (size_t i=p.size(); i-- > 0; ) {
+        if (p[i]) {
+            return (long)(64 * i) + polynomialDegree(p[i]);
+        }
+    }
+    return -1;
+}
+
+// gcd(a, b) over multi-word polynomials, the same algorithm as the single word version
+inline std::vector<uint64_t> polynomialGCD(std::vector<uint64_t> u, std::vector<uint64_t> v) {
+    // Only the low `length` words of each are live; the vectors are never resized in the loop
+    auto trim = [](const std::vector<uint64_t> &p, size_t length) {
+        while (length > 0 && p[length-1] == 0)
+            length--;
+        return length;
+    };
+    auto trailingZeros = [](const std::vector<uint64_t> &p) {
+        size_t word = 0;
+        while (p[word] == 0)
+            word++;
+        return 64 * word + __builtin_ctzll(p[word]);
+    };
+    // p >>= bits, within its live words
+    auto shiftDown = [](std::vector<uint64_t> &p, size_t length, size_t bits) {
+        size_t words = bits / 64, offset = bits % 64;
+        for (size_t i=0; i+words<length; i++) {
+            uint64_t next = (i+words+1 < length) ? p[i+words+1] : 0;
+            p[i] = offset ? (p[i+words] >> offset) | (next << (64 - offset)) : p[i+words];
+        }
+        for (size_t i=(length > words ? length - words : 0); i<length; i++) {
+            p[i] = 0;
+        }
+    };
+
+    size_t uLength = trim(u, u.size()), vLength = trim(v, v.size());
+    if (uLength == 0) {
+        v.resize(vLength);
+        return v;
+    }
+    if (vLength == 0) {
+        u.resize(uLength);
+        return u;
+    }
+    size_t shift = std::min(trailingZeros(u), trailingZeros(v));
+    shiftDown(u, uLength, trailingZeros(u));
+    uLength = trim(u, uLength);
+    while (true) {
+        shiftDown(v, vLength, trailingZeros(v));
+        vLength = trim(v, vLength);
+        bool swapNeeded = vLength < uLength;
+        if (vLength == uLength) {
+            swapNeeded = u[uLength-1] > v[vLength-1];
+        }
+        if (swapNeeded) {
+            std::swap(u, v);
+            std::swap(uLength, vLength);
+        }
+        for (size_t i=0; i<uLength; i++) {
+            v[i] ^= u[i];
+        }
+        vLength = trim(v, vLength);
+        if (vLength == 0) {
+            break;
+        }
+    }
+    // Put the common factor x^shift back
+    size_t words = shift / 64, offset = shift % 64;
+    std::vector<uint64_t> result(uLength + words + 1, 0);
+    for (size_t i=0; i<uLength; i++) {
+        result[i+words] |= u[i] << offset;
+        if (offset) {
+            result[i+words+1] |= u[i] >> (64 - offset);
+        }
+    }
+    result.resize(trim(result, result.size()));
+    return result;
+}
+
+// a*b; the longer operand is cut into pieces the length of the shorter so each clmulMultiply is balanced
+inline std::vector<uint64_t> polynomialMultiply(const std::vector<uint64_t> &a, const std::vector<uint64_t> &b) {
+    const std::vector<uint64_t> &longer = (a.size() >= b.size()) ? a : b, &shorter = (a.size() >= b.size()) ? b : a;
+    size_t n = shorter.size();
+    if (n == 0) {
+        return {};
+    }
+    std::vector<uint64_t> result(longer.size() + n, 0), piece(n), product(2 * n), scratch(clmulScratch(n));
+    for (size_t start=0; start<longer.size(); start+=n) {
+        for (size_t i=0; i<n; i++) {
+            piece[i] = (start + i < longer.size()) ? longer[start+i] : 0;
+        }
+        clmulMultiply(piece.data(), shorter.data(), n, product.data(), scratch.data());
+        // The words of the last product past the end of result are zero
+        for (size_t i=0; i<2*n && start+i<result.size(); i++) {
+            result[start+i] ^= product[i];
+        }
+    }
+    return result;
+}
+
+// a^2 in GF(2)[x] is a with its bits spread out (the cross terms cancel in pairs)
+inline std::vector<uint64_t> polynomialSquare(const std::vector<uint64_t> &a) {
+    std::vector<uint64_t> square(2 * a.size());
+    for (size_t i=0; i<a.size(); i++) {
+        clmulProduct p = clmulSquare(a[i]);
+        square[2*i] = p.low;
+        square[2*i+1] = p.high;
+    }
+    return square;
+}
+
+// p ^= t * x^position over words words, where position may be negative if the low -position bits of t are zero
+inline void xorShifted(uint64_t *p, size_t words, uint64_t t, long position) {
+    if (position < 0) {
+        p[0] ^= t >> -position;
+        return;
+    }
+    size_t word = position / 64;
+    int offset = position % 64;
+    p[word] ^= t << offset;
+    if (offset && word + 1 < words) {
+        p[word+1] ^= t >> (64 - offset);
+    }
+}
+
+/**
+ * Reduce the words-word polynomial p modulo f = x^m + sum of x^k over terms, in place; the words at and
+ * above degree m are cleared
+ *
+ * A word t of p above x^m is folded down as t * x^(64i-m) * (f - x^m), one shifted XOR per term of f, so
+ * trinomials and pentanomials reduce in O(words) and a dense f in O(words * weight).
+ */
+inline void polynomialReduce(uint64_t *p, size_t words, int m, const int *terms, size_t termCount) {
+    size_t boundary = m / 64;
+    uint64_t boundaryMask = ~((1ULL << (m % 64)) - 1); // bits of the boundary word at or above x^m
+    for (size_t i=words; i-- > boundary; ) {
+        while (true) {
+            uint64_t t = p[i];
+            if (i == boundary)
+                t &= boundaryMask;
+            if (t == 0)
+                break;
+            p[i] ^= t;
+            for (size_t j=0; j<termCount; j++) {
+                xorShifted(p, words, t, (long)(64 * i) - m + terms[j]);
+            }
+        }
+    }
+}
+inline void polynomialReduce(std::vector<uint64_t> &p, int m, const std::vector<int> &terms) {
+    polynomialReduce(p.data(), p.size(), m, terms.data(), terms.size());
+}
+
+// Exponents k < m of the terms of f, where m = deg(f)
+inline std::vector<int> polynomialTerms(const std::vector<uint64_t> &f) {
+    std::vector<int> terms;
+    long m = polynomialDegree(f);
+    for (long k=0; k<m; k++) {
+        if ((f[k / 64] >> (k % 64)) & 1)
+            terms.push_back((int)k);
+    }
+    return terms;
+}
+
+/**
+ * Rabin's irreducibility test for f of degree m >= 1 over GF(2)
+ *
+ * f is irreducible iff x^(2^m) = x mod f and gcd(x^(2^(m/q)) - x, f) = 1 for every prime q dividing m.
+ * That is m squarings mod f plus one gcd per prime factor of m; with a sparse f each squaring is O(m/64)
+ * word operations.
+ */
+inline bool polynomialIsIrreducible(const std::vector<uint64_t> &f) {
+    long m = polynomialDegree(f);
+    if (m < 1) {
+        return false;
+    }
+    if (m == 1) {
+        return true;
+    }
+    if ((f[0] & 1) == 0) {
+        return false; // divisible by x
+    }
+    std::vector<int> terms = polynomialTerms(f);
+    size_t words = m / 64 + 1;
+    std::vector<uint64_t> fTrimmed(f.begin(), f.begin() + words);
+
+    std::vector<uint64_t> primes = primeFactors((uint64_t)m);
+    std::vector<long> checkpoints; // m/q for each prime q dividing m, in ascending order
+    for (auto q = primes.rbegin(); q != primes.rend(); ++q) {
+        checkpoints.push_back(m / (long)*q);
+    }
+    std::sort(checkpoints.begin(), checkpoints.end());
+
+    std::vector<uint64_t> h(words, 0); // x^(2^k) mod f, k = 0
+    h[0] = 2;
+    size_t next = 0;
+    for (long k=1; k<=m; k++) {
+        h = polynomialSquare(h);
+        polynomialReduce(h, (int)m, terms);
+        h.resize(words);
+        while (next < checkpoints.size() && checkpoints[next] == k) {
+            std::vector<uint64_t> difference = h;
+            difference[0] ^= 2;
+            std::vector<uint64_t> g = polynomialGCD(difference, fTrimmed);
+            if (polynomialDegree(g) != 0) {
+                return false;
+            }
+            next++;
+        }
+    }
+    h[0] ^= 2;
+    return polynomialDegree(h) == -1;
+}
+
+// s*a + t*b = gcd, all products carry-less
+struct polynomialBezout {
+    uint64_t gcd;
+    uint64_t s;
+    uint64_t t;
+};
+
+/**
+ * Extended Euclidean algorithm in GF(2)[x]
+ *
+ * Each remainder is reduced by adding the divisor shifted up to its leading term, x^j*r1 with
+ * j = deg(r0) - deg(r1), so a division costs one step per quotient term rather than per bit. The cofactors
+ * satisfy deg(s) < deg(b) and deg(t) < deg(a), so they always fit in a word.
+ *
+ * @param trace If set, each division step is written to it as the quotient, remainder and cofactors in binary
+ */
+inline polynomialBezout polynomialExtendedGCD(uint64_t a, uint64_t b, std::ostream *trace = nullptr) {
+    uint64_t r0 = a, r1 = b;
+    uint64_t s0 = 1, s1 = 0;
+    uint64_t t0 = 0, t1 = 1;
+    if (trace) {
+        *trace << "q r s t\n";
+    }
+    while (r1 != 0) {
+        int d1 = polynomialDegree(r1);
+        uint64_t q = 0;
+        for (int j=polynomialDegree(r0)-d1; j>=0; j=polynomialDegree(r0)-d1) {
+            q ^= 1ULL << j;
+            r0 ^= r1 << j;
+            s0 ^= s1 << j;
+            t0 ^= t1 << j;
+        }
+        if (trace) {
+            *trace << std::hex << q << " " << r0 << " " << s0 << " " << t0 << std::dec << "\n";
+        }
+        std::swap(r0, r1);
+        std::swap(s0, s1);
+        std::swap(t0, t1);
+    }
+    return {r0, s0, t0};
+}
+
+/**
+ * Inverse of a modulo f = x^m + reduction, m <= 64, by the extended Euclidean algorithm
+ *
+ * Only the cofactor of a is tracked. f needs m+1 bits, so the first step, which cancels its x^m term, is done
+ * by hand and everything after it has degree below m. Returns 0 if a is 0 or shares a factor with f.
+ */
+inline uint64_t polynomialInverseMod(uint64_t a, int m, uint64_t reduction) {
+    uint64_t mask = (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+    a &= mask;
+    if (a <= 1) {
+        return a;
+    }
+    // v = f + x^j*a with j = m - deg(a) >= 1; the x^m terms cancel (for m = 64 the shift drops it)
+    int j = m - polynomialDegree(a);
+    uint64_t u = a, v = ((a << j) & mask) ^ reduction;
+    uint64_t g1 = 1, g2 = 1ULL << j;
+    // g1*a = u and g2*a = v mod f, with deg(g1) <= m - deg(v) and deg(g2) <= m - deg(u); stopping at whichever of
+    // u, v reaches 1 first keeps the returned cofactor below degree m
+    while (u != 1 && v != 1) {
+        if (v == 0) {
+            return 0;
+        }
+        j = polynomialDegree(u) - polynomialDegree(v);
+        if (j < 0) {
+            std::swap(u, v);
+            std::swap(g1, g2);
+            j = -j;
+        }
+        u ^= v << j;
+        g1 ^= g2 << j;
+        if (u == 0) {
+            return 0;
+        }
+    }
+    return (u == 1) ? g1 : g2;
+}
+
+#endif // BINARY_POLYNOMIAL_HPP
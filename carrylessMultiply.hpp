@@ -0,0 +1,545 @@
+#ifndef CARRYLESS_MULTIPLY_HPP
+#define CARRYLESS_MULTIPLY_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <chrono>
+#include "cpuFeatures.hpp"
+
+/*
+    Carry-less (GF(2)[x]) multiplication of 64-bit words, and Barrett reduction of the 128-bit product
+    modulo a degree m <= 64 defining polynomial f = x^m + r.
+*/
+
+struct clmulProduct {
+    uint64_t low;
+    uint64_t high;
+};
+
+// The 16 multiples a*i, i < 16, of a 64-bit polynomial, as 128-bit values
+struct clmulWindow {
+    uint64_t low[16];
+    uint64_t high[16];
+};
+
+inline void makeClmulWindow(clmulWindow &window, uint64_t a) {
+    window.low[0] = 0;
+    window.high[0] = 0;
+    window.low[1] = a;
+    window.high[1] = 0;
+    for (int i=2; i<16; i+=2) {
+        // i*a = (i/2)*a*x, and (i+1)*a = i*a + a
+        window.low[i] = window.low[i/2] << 1;
+        window.high[i] = (window.high[i/2] << 1) | (window.low[i/2] >> 63);
+        window.low[i+1] = window.low[i] ^ a;
+        window.high[i+1] = window.high[i];
+    }
+}
+
+// a*b from the window of a, four bits of b at a time
+inline clmulProduct clmulWindowed(const clmulWindow &window, uint64_t b) {
+    uint64_t low = 0, high = 0;
+    if (b == 0) {
+        return {0, 0};
+    }
+    // Start at the highest nonzero nibble of b; field operands rarely fill the word
+    int top = (63 - __builtin_clzll(b)) & ~3;
+    for (int shift=top; shift>=0; shift-=4) {
+        high = (high << 4) | (low >> 60);
+        low <<= 4;
+        unsigned nibble = (b >> shift) & 15;
+        low ^= window.low[nibble];
+        high ^= window.high[nibble];
+    }
+    return {low, high};
+}
+
+// Portable 64x64 -> 128 carry-less product
+inline clmulProduct clmulPortable(uint64_t a, uint64_t b) {
+    clmulWindow window;
+    makeClmulWindow(window, a);
+    return clmulWindowed(window, b);
+}
+
+// Bits 0..31 of w moved to the even positions 0..62: the carry-less square of a 32-bit polynomial
+inline uint64_t spreadBits(uint32_t w) {
+    uint64_t x = w;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+}
+
+// The even bits of x packed into the low 32, the inverse of spreadBits
+inline uint32_t compressBits(uint64_t x) {
+    x &= 0x5555555555555555ULL;
+    x = (x | (x >> 1)) & 0x3333333333333333ULL;
+    x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return (uint32_t)x;
+}
+
+#if GALOIS_X86
+// PDEP and PEXT do the spreading and packing in one instruction each
+__attribute__((target("bmi2")))
+inline clmulProduct clmulSquarePdep(uint64_t a) {
+    return {_pdep_u64(a, 0x5555555555555555ULL), _pdep_u64(a >> 32, 0x5555555555555555ULL)};
+}
+
+__attribute__((target("bmi2")))
+inline uint64_t evenOddBitsPext(uint64_t a) {
+    return _pext_u64(a, 0x5555555555555555ULL) | (_pext_u64(a, 0xAAAAAAAAAAAAAAAAULL) << 32);
+}
+#endif
+
+// a^2 as a 128-bit carry-less product: the bits of a spread to the even positions, the cross terms cancel
+inline clmulProduct clmulSquare(uint64_t a) {
+#if GALOIS_X86
+    if (cpuFeatures::get().bmi2) {
+        return clmulSquarePdep(a);
+    }
+#endif
+    return {spreadBits((uint32_t)a), spreadBits((uint32_t)(a >> 32))};
+}
+
+// The even bits of a in the low 32 bits of the result and the odd bits in the high 32
+inline uint64_t evenOddBits(uint64_t a) {
+#if GALOIS_X86
+    if (cpuFeatures::get().bmi2) {
+        return evenOddBitsPext(a);
+    }
+#endif
+    return compressBits(a) | ((uint64_t)compressBits(a >> 1) << 32);
+}
+
+// Bits [m, m+64) of a 128-bit value
+inline uint64_t shiftRight128(clmulProduct p, int m) {
+    if (m == 0) {
+        return p.low;
+    }
+    if (m >= 64) {
+        return p.high >> (m - 64);
+    }
+    return (p.low >> m) | (p.high << (64 - m));
+}
+
+/*
+    Barrett reduction over GF(2)[x]: with mu = floor(x^2m / f), the quotient of a product P (deg P < 2m) is
+    exactly q = floor(floor(P / x^m) * mu / x^m) and P mod f = (P + q*f) mod x^m. mu = x^m + muLow and
+    f = x^m + r, so both products only need the low words and the x^m terms become shifts.
+*/
+template <typename Clmul>
+inline uint64_t barrettReduce(clmulProduct product, int m, uint64_t mask, uint64_t r, uint64_t muLow, Clmul clmul) {
+    uint64_t high = shiftRight128(product, m);
+    uint64_t q = high ^ shiftRight128(clmul(high, muLow), m);
+    return (product.low ^ clmul(q, r).low) & mask;
+}
+
+// muLow = floor(x^2m / f) - x^m, by long division (setup only)
+inline uint64_t barrettConstant(int m, uint64_t r) {
+    // Remainder of x^k mod f as k runs from m to 2m-1 decides the quotient bits, highest first
+    uint64_t mask = (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+    uint64_t remainder = r; // x^m mod f
+    uint64_t quotient = 0;  // bits below x^m of the quotient
+    for (int k=m; k<2*m; k++) {
+        // remainder currently holds x^k mod f with the quotient bits for x^m..x^(k-1) accounted for
+        // Multiplying by x: the bit leaving the top of the remainder is the next quotient bit
+        int bit = (remainder >> (m - 1)) & 1;
+        quotient = (quotient << 1) | bit;
+        remainder = ((remainder << 1) & mask) ^ (bit ? r : 0);
+    }
+    return quotient & mask;
+}
+
+/*
+    Reduction modulo a trinomial or pentanomial f = x^m + x^a (+ x^b + x^c) + 1 with a <= m/2: the part H of
+    the product at and above x^m satisfies H*x^m = H*(f - x^m), so it folds down as a few shifted XORs. The
+    first fold leaves at most a-1 bits above x^m and the second none. Terms is 1 (a) or 3 (a, b, c).
+*/
+template <int Terms>
+inline uint64_t sparseReduce(clmulProduct product, int m, uint64_t mask, const int *terms) {
+    if (m <= 32) {
+        // The product has fewer than 64 bits, so the folds stay in one word
+        uint64_t p = product.low;
+        for (int fold=0; fold<2; fold++) {
+            uint64_t high = p >> m;
+            p = (p & mask) ^ high;
+            for (int i=0; i<Terms; i++) {
+                p ^= high << terms[i];
+            }
+        }
+        return p;
+    }
+    // First fold: high has up to m-1 bits, so the shifted copies can cross into the second word
+    uint64_t high = shiftRight128(product, m);
+    uint64_t low = (product.low & mask) ^ high, carry = 0;
+    for (int i=0; i<Terms; i++) {
+        low ^= high << terms[i];
+        carry ^= high >> (64 - terms[i]); // terms are at least 1
+    }
+    // Second fold: fewer than a <= m/2 bits remain above x^m, and their shifted copies fit in one word
+    high = shiftRight128({low, carry}, m);
+    low = (low & mask) ^ high;
+    for (int i=0; i<Terms; i++) {
+        low ^= high << terms[i];
+    }
+    return low;
+}
+
+#if GALOIS_X86
+__attribute__((target("pclmul,sse2")))
+inline clmulProduct clmulHardware(uint64_t a, uint64_t b) {
+    __m128i product = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)a), _mm_cvtsi64_si128((long long)b), 0x00);
+    return {(uint64_t)_mm_cvtsi128_si64(product), (uint64_t)_mm_cvtsi128_si64(_mm_unpackhi_epi64(product, product))};
+}
+
+// Full multiply-and-reduce in one target function so the PCLMULQDQ calls inline; the steps of barrettReduce
+// are spelled out because a functor without the target attribute would not inline them
+__attribute__((target("pclmul,sse2")))
+inline uint64_t multiplyModHardware(uint64_t a, uint64_t b, int m, uint64_t mask, uint64_t r, uint64_t muLow) {
+    clmulProduct product = clmulHardware(a, b);
+    uint64_t high = shiftRight128(product, m);
+    uint64_t q = high ^ shiftRight128(clmulHardware(high, muLow), m);
+    return (product.low ^ clmulHardware(q, r).low) & mask;
+}
+
+template <int Terms>
+__attribute__((target("pclmul,sse2")))
+inline uint64_t multiplyModHardwareSparse(uint64_t a, uint64_t b, int m, uint64_t mask, const int *terms) {
+    return sparseReduce<Terms>(clmulHardware(a, b), m, mask, terms);
+}
+#endif
+
+inline uint64_t multiplyModPortable(uint64_t a, uint64_t b, int m, uint64_t mask, uint64_t r, uint64_t muLow) {
+    return barrettReduce(clmulPortable(a, b), m, mask, r, muLow, clmulPortable);
+}
+
+template <int Terms>
+inline uint64_t multiplyModPortableSparse(uint64_t a, uint64_t b, int m, uint64_t mask, const int *terms) {
+    return sparseReduce<Terms>(clmulPortable(a, b), m, mask, terms);
+}
+
+/*
+    Multi-word carry-less products for fields beyond 64 bits. Operands are n words, least significant first,
+    and the product is 2n words.
+*/
+
+inline void clmulSchoolbookPortable(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out) {
+    for (size_t i=0; i<2*n; i++) {
+        out[i] = 0;
+    }
+    clmulWindow window;
+    for (size_t i=0; i<n; i++) {
+        if (a[i] == 0)
+            continue;
+        makeClmulWindow(window, a[i]);
+        for (size_t j=0; j<n; j++) {
+            clmulProduct p = clmulWindowed(window, b[j]);
+            out[i+j] ^= p.low;
+            out[i+j+1] ^= p.high;
+        }
+    }
+}
+
+#if GALOIS_X86
+// Column by column so each output word is written once, with the two halves of each 128-bit product
+// accumulated in registers
+__attribute__((target("pclmul,sse2")))
+inline void clmulSchoolbookHardware(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out) {
+    __m128i carry = _mm_setzero_si128();
+    for (size_t k=0; k<2*n-1; k++) {
+        __m128i sum = carry;
+        size_t first = (k >= n) ? k - n + 1 : 0, last = (k < n) ? k : n - 1;
+        for (size_t i=first; i<=last; i++) {
+            __m128i product = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)a[i]), _mm_cvtsi64_si128((long long)b[k-i]), 0x00);
+            sum = _mm_xor_si128(sum, product);
+        }
+        out[k] = (uint64_t)_mm_cvtsi128_si64(sum);
+        carry = _mm_srli_si128(sum, 8);
+    }
+    out[2*n-1] = (uint64_t)_mm_cvtsi128_si64(carry);
+}
+#endif
+
+inline void clmulSchoolbook(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out) {
+#if GALOIS_X86
+    if (cpuFeatures::get().pclmul) {
+        clmulSchoolbookHardware(a, b, n, out);
+        return;
+    }
+#endif
+    clmulSchoolbookPortable(a, b, n, out);
+}
+
+/*
+    Operand sizes (in words) at which clmulMultiply switches from schoolbook to Karatsuba and from Karatsuba
+    to Toom-3. The defaults were measured: with PCLMULQDQ a word product costs little more than the XORs the
+    splitting adds, so Karatsuba pays from about 32 words and Toom-3 from a few hundred; the portable word
+    product is dear enough that Karatsuba pays from 4. tuneClmulThresholds() measures them on the running
+    machine instead.
+*/
+struct clmulThresholds {
+    size_t karatsuba;
+    size_t toom3;
+};
+
+// Toom-3 needs its three pieces and the two-bit growth of the evaluations to stay below n
+const size_t toom3Minimum = 6;
+
+inline clmulThresholds &clmulTuning() {
+    static clmulThresholds thresholds = cpuFeatures::get().pclmul ? clmulThresholds{32, 256} : clmulThresholds{4, 96};
+    return thresholds;
+}
+
+/**
+ * Scratch words clmulMultiply (and clmulKaratsuba, clmulToom3) need for n-word operands, whatever the thresholds
+ */
+constexpr size_t clmulScratch(size_t n) {
+    size_t words = 0;
+    while (n >= 2) {
+        size_t half = (n + 1) / 2, third = (n + 2) / 3;
+        size_t local = 4 * half, next = half;
+        if (n >= toom3Minimum) {
+            local = (local > 8 * (third + 1)) ? local : 8 * (third + 1);
+            next = (next > third + 1) ? next : third + 1;
+        }
+        words += local;
+        n = next;
+    }
+    return words;
+}
+
+inline void clmulMultiply(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out, uint64_t *scratch);
+
+/**
+ * One Karatsuba step: with a = a0 + a1*X and b = b0 + b1*X (X = x^(64*half)),
+ * a*b = a0*b0 + ((a0+a1)(b0+b1) + a0*b0 + a1*b1)*X + a1*b1*X^2, three half-size products instead of four
+ *
+ * @param scratch At least clmulScratch(n) words
+ */
+inline void clmulKaratsuba(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out, uint64_t *scratch) {
+    size_t half = (n + 1) / 2, high = n - half;
+    uint64_t *aSum = scratch, *bSum = scratch + half, *middle = scratch + 2*half, *rest = scratch + 4*half;
+
+    // a0*b0 in out[0, 2half), a1*b1 in out[2half, 2n)
+    clmulMultiply(a, b, half, out, rest);
+    if (high == half) {
+        clmulMultiply(a + half, b + half, high, out + 2*half, rest);
+    } else {
+        // Odd n: pad a1 and b1 to half words so the recursion stays on one size
+        for (size_t i=0; i<half; i++) {
+            aSum[i] = (i < high) ? a[half+i] : 0;
+            bSum[i] = (i < high) ? b[half+i] : 0;
+        }
+        clmulMultiply(aSum, bSum, half, middle, rest);
+        for (size_t i=0; i<2*high; i++) {
+            out[2*half+i] = middle[i];
+        }
+    }
+
+    for (size_t i=0; i<half; i++) {
+        aSum[i] = a[i] ^ ((i < high) ? a[half+i] : 0);
+        bSum[i] = b[i] ^ ((i < high) ? b[half+i] : 0);
+    }
+    clmulMultiply(aSum, bSum, half, middle, rest);
+    for (size_t i=0; i<2*half; i++) {
+        middle[i] ^= out[i] ^ ((i < 2*high) ? out[2*half+i] : 0);
+    }
+    for (size_t i=0; i<2*half; i++) {
+        out[half+i] ^= middle[i];
+    }
+}
+
+// dst ^= src * x^bits for 0 < bits < 64; dst has room for words+1 words
+inline void xorShiftedBits(uint64_t *dst, const uint64_t *src, size_t words, int bits) {
+    uint64_t carry = 0;
+    for (size_t i=0; i<words; i++) {
+        dst[i] ^= (src[i] << bits) | carry;
+        carry = src[i] >> (64 - bits);
+    }
+    dst[words] ^= carry;
+}
+
+// p /= x, exact (bit 0 is zero)
+inline void divideByX(uint64_t *p, size_t words) {
+    for (size_t i=0; i+1<words; i++) {
+        p[i] = (p[i] >> 1) | (p[i+1] << 63);
+    }
+    p[words-1] >>= 1;
+}
+
+// p /= x + 1, exact: q = p / (x+1) has q_i = p_(i+1) + p_(i+2) + ..., a suffix XOR shifted down one bit
+inline void divideByXPlusOne(uint64_t *p, size_t words) {
+    uint64_t parity = 0; // XOR of all bits above the current word, as all zeros or all ones
+    for (size_t i=words; i-- > 0;) {
+        uint64_t x = p[i];
+        x ^= x >> 1;
+        x ^= x >> 2;
+        x ^= x >> 4;
+        x ^= x >> 8;
+        x ^= x >> 16;
+        x ^= x >> 32;
+        p[i] = x ^ parity;
+        parity = 0 - (p[i] & 1);
+    }
+    divideByX(p, words);
+}
+
+/**
+ * One Toom-3 step over GF(2)[x] (Bodrato's evaluation points 0, 1, x, x+1 and infinity): a and b split into
+ * three pieces of third words, a*b = c0 + c1*X + ... + c4*X^4 comes from five products of about n/3 words
+ * and an interpolation made of shifts, XORs and one exact division by x+1
+ *
+ * @param scratch At least clmulScratch(n) words; n must be at least toom3Minimum
+ */
+inline void clmulToom3(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out, uint64_t *scratch) {
+    size_t third = (n + 2) / 3, high = n - 2*third, e = third + 1, length = 2 * e;
+    const uint64_t *a1 = a + third, *a2 = a + 2*third, *b1 = b + third, *b2 = b + 2*third;
+    uint64_t *aEval = scratch, *bEval = scratch + e;
+    uint64_t *w1 = scratch + length, *wx = w1 + length, *wx1 = wx + length, *rest = wx1 + length;
+
+    // c0 = a0*b0 and c4 = a2*b2 land in place (out has 4*third + 2*high words), with zeros between them
+    clmulMultiply(a, b, third, out, rest);
+    clmulMultiply(a2, b2, high, out + 4*third, rest);
+    for (size_t i=2*third; i<4*third; i++) {
+        out[i] = 0;
+    }
+    const uint64_t *c0 = out, *c4 = out + 4*third;
+
+    // A(1) = a0 + a1 + a2
+    for (size_t i=0; i<e; i++) {
+        aEval[i] = (i < third) ? a[i] ^ a1[i] ^ ((i < high) ? a2[i] : 0) : 0;
+        bEval[i] = (i < third) ? b[i] ^ b1[i] ^ ((i < high) ? b2[i] : 0) : 0;
+    }
+    clmulMultiply(aEval, bEval, third, w1, rest);
+    w1[2*third] = w1[2*third+1] = 0;
+
+    // A(x+1) = A(1) + a1*x + a2*x^2
+    xorShiftedBits(aEval, a1, third, 1);
+    xorShiftedBits(aEval, a2, high, 2);
+    xorShiftedBits(bEval, b1, third, 1);
+    xorShiftedBits(bEval, b2, high, 2);
+    clmulMultiply(aEval, bEval, e, wx1, rest);
+
+    // A(x) = A(x+1) + A(1) + a0 = A(x+1) + a1 + a2
+    for (size_t i=0; i<third; i++) {
+        aEval[i] ^= a1[i] ^ ((i < high) ? a2[i] : 0);
+        bEval[i] ^= b1[i] ^ ((i < high) ? b2[i] : 0);
+    }
+    clmulMultiply(aEval, bEval, e, wx, rest);
+
+    // Remove c0 and c4 from the three products:
+    //   w1 = c1 + c2 + c3, wx = c1 + c2*x + c3*x^2, wx1 = c1 + c2*(x+1) + c3*(x+1)^2
+    for (size_t i=0; i<2*third; i++) {
+        w1[i] ^= c0[i];
+        wx[i] ^= c0[i];
+        wx1[i] ^= c0[i];
+    }
+    for (size_t i=0; i<2*high; i++) {
+        w1[i] ^= c4[i];
+        wx1[i] ^= c4[i]; // (x+1)^4 = x^4 + 1
+    }
+    xorShiftedBits(wx, c4, 2*high, 4);
+    xorShiftedBits(wx1, c4, 2*high, 4);
+    divideByX(wx, length);
+    divideByXPlusOne(wx1, length);
+
+    // wx + wx1 = c2 + c3, so c1 = w1 + wx + wx1; (wx + c1)/x = c2 + c3*x, so c3 = ((wx + c1)/x + c2 + c3)/(x+1)
+    uint64_t *c23 = aEval, *c1 = w1, *c3 = wx;
+    for (size_t i=0; i<length; i++) {
+        c23[i] = wx[i] ^ wx1[i];
+        c1[i] ^= c23[i];
+        wx[i] ^= c1[i];
+    }
+    divideByX(wx, length);
+    for (size_t i=0; i<length; i++) {
+        c3[i] ^= c23[i];
+    }
+    divideByXPlusOne(c3, length);
+
+    // c2 = c23 + c3; c1 and c2 have 2*third words and c3 = a1*b2 + a2*b1 has third + high
+    for (size_t i=0; i<2*third; i++) {
+        out[third+i] ^= c1[i];
+        out[2*third+i] ^= c23[i] ^ c3[i];
+    }
+    for (size_t i=0; i<third+high; i++) {
+        out[3*third+i] ^= c3[i];
+    }
+}
+
+/**
+ * n-word by n-word carry-less product into 2n words: schoolbook, Karatsuba or Toom-3 by operand size
+ *
+ * @param scratch At least clmulScratch(n) words
+ */
+inline void clmulMultiply(const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out, uint64_t *scratch) {
+    const clmulThresholds &thresholds = clmulTuning();
+    if (n >= thresholds.toom3 && n >= toom3Minimum) {
+        clmulToom3(a, b, n, out, scratch);
+    } else if (n >= thresholds.karatsuba && n >= 2) {
+        clmulKaratsuba(a, b, n, out, scratch);
+    } else {
+        clmulSchoolbook(a, b, n, out);
+    }
+}
+
+/*
+    Measures the crossovers on this machine and stores them in clmulTuning(): the smallest size where one
+    Karatsuba step beats schoolbook, then the smallest where one Toom-3 step beats Karatsuba. A method that
+    never wins is left for sizes past the largest measured. Takes a few tenths of a second; call it once at
+    startup, before other threads multiply.
+*/
+inline clmulThresholds tuneClmulThresholds() {
+    clmulThresholds &thresholds = clmulTuning();
+    const size_t largest = 512;
+    std::vector<uint64_t> a(largest), b(largest), out(2 * largest), scratch(clmulScratch(largest));
+    uint64_t seed = 0x9E3779B97F4A7C15ULL;
+    for (size_t i=0; i<largest; i++) {
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        a[i] = seed;
+        seed ^= seed << 13; seed ^= seed >> 7; seed ^= seed << 17;
+        b[i] = seed;
+    }
+    // Fastest of three runs of about a millisecond each, in ns per product
+    auto time = [&](void (*product)(const uint64_t*, const uint64_t*, size_t, uint64_t*, uint64_t*), size_t n) {
+        double best = 0;
+        for (int run=0; run<3; run++) {
+            size_t count = 0;
+            auto start = std::chrono::steady_clock::now();
+            double elapsed;
+            do {
+                product(a.data(), b.data(), n, out.data(), scratch.data());
+                count++;
+                elapsed = std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count();
+            } while (elapsed < 1e6);
+            if (run == 0 || elapsed / count < best)
+                best = elapsed / count;
+        }
+        return best;
+    };
+    auto schoolbook = [](const uint64_t *a, const uint64_t *b, size_t n, uint64_t *out, uint64_t *) {
+        clmulSchoolbook(a, b, n, out);
+    };
+
+    thresholds = {largest + 1, largest + 1};
+    for (size_t n: {2, 3, 4, 6, 8, 12, 16, 24, 32, 48, 64, 96, 128}) {
+        if (time(clmulKaratsuba, n) < time(schoolbook, n)) {
+            thresholds.karatsuba = n;
+            break;
+        }
+    }
+    for (size_t n: {12, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512}) {
+        if (n >= toom3Minimum && time(clmulToom3, n) < time(clmulKaratsuba, n)) {
+            thresholds.toom3 = n;
+            break;
+        }
+    }
+    return thresholds;
+}
+
+#endif // CARRYLESS_MULTIPLY_HPP
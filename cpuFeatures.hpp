@@ -0,0 +1,47 @@
+#ifndef CPU_FEATURES_HPP
+#define CPU_FEATURES_HPP
+
+/*
+    Runtime detection of the x86 instruction set extensions the arithmetic kernels can use.
+    Kernels that need an extension are compiled with a target attribute (no -march flag required) and only
+    called when cpuFeatures reports the extension, so one binary runs everywhere.
+*/
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define GALOIS_X86 1
+#include <immintrin.h>
+#else
+#define GALOIS_X86 0
+#endif
+
+struct cpuFeatures {
+    bool pclmul = false;   // PCLMULQDQ carry-less multiply
+    bool ssse3 = false;    // PSHUFB byte shuffle
+    bool avx2 = false;
+    bool avx512bw = false;
+    bool gfni = false;     // GF2P8MULB / GF2P8AFFINEQB
+    bool bmi2 = false;     // PDEP / PEXT
+
+    // Detected once, on first use
+    static const cpuFeatures& get() {
+        static const cpuFeatures detected = detect();
+        return detected;
+    }
+
+    private:
+        static cpuFeatures detect() {
+            cpuFeatures f;
+#if GALOIS_X86
+            __builtin_cpu_init();
+            f.pclmul = __builtin_cpu_supports("pclmul");
+            f.ssse3 = __builtin_cpu_supports("ssse3");
+            f.avx2 = __builtin_cpu_supports("avx2");
+            f.avx512bw = __builtin_cpu_supports("avx512bw");
+            f.gfni = __builtin_cpu_supports("gfni");
+            f.bmi2 = __builtin_cpu_supports("bmi2");
+#endif
+            return f;
+        }
+};
+
+#endif // CPU_FEATURES_HPP
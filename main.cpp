@@ -1,11 +1,8 @@
 #include <iostream>
-#include <iomanip>
-#include <vector>
-#include <cmath>
-#include "boost/dynamic_bitset.hpp"
-#include <algorithm>
-#include <iterator>
-#include <string>
+#include <fstream>
+#include <cstring>
+#include <climits>
+#include "GaloisField.hpp"
 using namespace std;
 
 /*
@@ -14,458 +11,357 @@ for the multiplicative inverses. You may represent elements using binary string
 */
 
 
+/*
+// Temporary Main to test functionality
+int main() {
+    int m = 4;
+    int definingPolynomial = 19;
+    GaloisField field(4, 19);
 
-class fieldElement {
-    private:
-        int bitwidth = 4;
-        boost::dynamic_bitset <uint32_t> value;// = boost::dynamic_bitset <uint32_t> (bitwidth, 0);
-        boost::dynamic_bitset <uint32_t> definingPolynomial;
-    public:
-
-        int getTrailingZeros(boost::dynamic_bitset <uint32_t> bits) {
-            int count = 0;
-            for (int i=0; i<bits.size(); i++) {
-                if (bits[i] == 0) {
-                    count++;
-                } else {
-                    break;
-                }
-            }
-
-            return count;
-        }
-
+    fieldElement element0 = field[4];
+    fieldElement element1 = field[5];
 
+    //cout << element0.getValue() << endl;
+    //cout << element1.getValue() << endl;
 
-        fieldElement fieldElementGCD(fieldElement u, fieldElement v) {
+    element0.getBezoutCoefficients(element0, element1, &cout);
+}
+*/
 
-            if ((int)u.value.to_ulong() == 0) {
-                return v;
-            } else if ((int)v.value.to_ulong() == 0) {
-                return u;
-            }
-            // Rust implementation: https://en.wikipedia.org/wiki/Binary_GCD_algorithm
+/*
+Batch mode, for scripted use. No prompts, and output is written in large blocks instead of per line.
 
-            /*
-                Important identities
-                1. gcd(0,v) = v
-                2. gcd(2u,2v) = 2gcd(u,v)
-                3. gcd(2u,v) = gcd(u,v) if v is odd
-                   gcd(u,2v) = gcd(u,v) if u is odd
-                4. gcd(u,v) = gcd(|u-v|, min(u, v)) if u and v are both odd
-            */
+    galoisfield --batch m poly [file]          text: one "a op b" per line, e.g. "5 * 7", "0b101 * 0x7"
+    galoisfield --batch-binary m poly [file]   binary records, see runBinaryBatch
 
-            int i = getTrailingZeros(u.value);
-            int j = getTrailingZeros(v.value);
+Input is read from file if given, otherwise stdin; results go to stdout and bad input is reported on stderr.
+*/
 
-            u.value = u.value >> i;
-            v.value = v.value >> j;
-            int k = min(i,j);
+// Parses a decimal, 0x hexadecimal or 0b binary number after optional spaces; false if there are no digits or
+// the number does not fit in 64 bits
+bool parseNumber(const char *&p, uint64_t &value) {
+    while (*p == ' ' || *p == '\t')
+        p++;
+    int base = 10;
+    if (p[0] == '0' && (p[1] == 'x' || p[1] == 'X')) {
+        base = 16;
+        p += 2;
+    } else if (p[0] == '0' && (p[1] == 'b' || p[1] == 'B')) {
+        base = 2;
+        p += 2;
+    }
+    value = 0;
+    const char *start = p;
+    while (true) {
+        int digit;
+        if (*p >= '0' && *p <= '9')
+            digit = *p - '0';
+        else if (*p >= 'a' && *p <= 'f')
+            digit = *p - 'a' + 10;
+        else if (*p >= 'A' && *p <= 'F')
+            digit = *p - 'A' + 10;
+        else
+            break;
+        if (digit >= base)
+            break;
+        if (value > (UINT64_MAX - digit) / base)
+            return false;
+        value = value * base + digit;
+        p++;
+    }
+    return p != start;
+}
 
-            while ((int)u.value.to_ulong() % 2 == 1 && (int)v.value.to_ulong() % 2 == 1) {
-                if (u.value > v.value) {
-                    // swap u and v so that u <= v
-                    fieldElement tmp = u;
-                    u = v;
-                    v = tmp;
-                }
-                v.value = v.value - u.value;
-                if ((int)v.value.to_ulong() == 0) {
-                    fieldElement returnVal(u.bitwidth, (int)(u.value << k).to_ulong(), (int)u.definingPolynomial.to_ulong());
-                    return returnVal;
-                }
+// Largest element of GF(2^m), 2^m - 1
+uint64_t elementLimit(int m) {
+    return (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+}
 
-                v.value = v.value >> getTrailingZeros(v.value);
-            }
-        }
+// Reads one whitespace-separated number for the interactive prompts; false for anything else, such as "-3"
+bool readNumber(istream &in, uint64_t &value) {
+    string token;
+    if (!(in >> token)) {
+        return false;
+    }
+    const char *p = token.c_str();
+    return parseNumber(p, value) && *p == '\0';
+}
 
-        vector<int> getBezoutCoefficients(fieldElement aElem, fieldElement bElem) {
-            // a*s + b*t = gcd(a,b)
-            int gcd = (int)fieldElementGCD(aElem, bElem).getValue().to_ulong(); // Get GCD element converted to integer
-            int a = (int)aElem.getValue().to_ulong();
-            int b = (int)bElem.getValue().to_ulong();
-            int s, t;
-            // If b=definingPolynomial, the GCD should be 1, s will be the inverse of a
-            /*
-                10(ish) step process:
-                1.  Setup initial tables of 5 columns (iteration, remainder, quotient, s, t)
-                2.  Insert numerator into R0C1
-                3.  Insert denominator into R1C1
-                4.  Integer divide R0C1 by R1C1 and place result into R1C2
-                5.  Place remainder from (4) into R2C1
-                6.  Add new row to table, increment i (i is not the new row, it is *now* the one before the new row)
-                7.  RiC2 is integer division (Ri-1)Ci/RiCi
-                8.  Place remainder from (7) into (Ri+1)C1
-                9.  RiC3 is (Ri-2)C3 - ((Ri-1)C2 * (Ri-1)C3)
-                10. RiC4 is (Ri-2)C4 - ((Ri-1)C2 * (Ri-1)C4)
-                Repeat steps 6-10 until RiC1 = 0
-            */
-            // Step 1, create initial table
-            vector<vector<int>> table = {
-                //i, r, q, s, t
-                 {0, -1, -1, 1, 0}, // R0
-                 {1, -1, -1, 0, 1}, // R1
-                 {2, -1, -1, -1, -1}, // R2
-            };
-            // Step 2, Insert numerator into R0C1
-            table[0][1] = a;
-            // Step 3, insert denominator into R1C1
-            table[1][1] = b;
-            // Step 4, integer divide R0C1 by R1C1, place result into R1C2
-            table[1][2] = table[0][1] / table[1][1];
-            // Step 5, place remainder from (4) into R1C2
-            table[2][1] = table[0][1] % table[1][1];
+// As readNumber for a signed exponent, e.g. -3; false if it does not fit in a long long
+bool readExponent(istream &in, long long &value) {
+    string token;
+    if (!(in >> token)) {
+        return false;
+    }
+    const char *p = token.c_str();
+    bool negative = (*p == '-');
+    if (negative)
+        p++;
+    uint64_t magnitude;
+    if (!parseNumber(p, magnitude) || *p != '\0' || magnitude > (negative ? (uint64_t)LLONG_MAX + 1 : (uint64_t)LLONG_MAX)) {
+        return false;
+    }
+    value = negative ? (long long)(0 - magnitude) : (long long)magnitude;
+    return true;
+}
 
-            // Repeat Steps 6-10 until RiC1 = 0
-            int i = 2; 
-            for (i; i<1000000; i++) {
-                // Step 6, add new line to table, increment i;
-                vector<int> tmpVect = {i+1, -1, -1, -1, -1};
-                table.insert(table.begin() + table.size(), tmpVect);
+// a op b with the silent arithmetic core, where for ^ b is any unsigned exponent; false for an unknown operator
+// or division by zero
+bool compute(const fieldArithmetic &arithmetic, uint64_t a, char op, uint64_t b, uint64_t &result) {
+    switch (op) {
+        case '+':
+        case '-':
+            result = a ^ b;
+            return true;
+        case '*':
+            result = arithmetic.multiply(a, b);
+            return true;
+        case '/':
+            if (b == 0)
+                return false;
+            result = arithmetic.divide(a, b);
+            return true;
+        case '^':
+            result = arithmetic.powerUnsigned(a, b);
+            return true;
+    }
+    return false;
+}
 
-                // Step 7, RiC2 is integer division (Ri-1)Ci/RiCi
-                table[i][2] = table[i-1][1] / table[i][2];
-                cout << table[i][2] << "=" << table[i-1][1] << "/" << table[i][2] << endl;
-                // Step 8, Place remainder from (7) into (Ri+1)C1
-                table[i+1][1] = table[i-1][1] % table[i][2];
-                cout << table[i+1][1] << "=" << table[i-1][1] << "%" << table[i][2] << endl;
-                // Step 9, RiC3 is (Ri-2)C3 - ((Ri-1)C2 * (Ri-1)C3)
-                table[i][3] = table[i-2][3] - (table[i-1][2] * table[i-1][3]);
-                cout << table[i][3] << "=" << table[i-2][3] << "-" << "(" << table[i-1][2] << "*" << table[i-1][3] << endl;
-                // Step 10, RiC4 is (Ri-2)C4 - ((Ri-1)C2 * (Ri-1)C4)
-                table[i][4] = table[i-2][4] - (table[i-1][2] * table[i-1][4]);
-                cout << table[i][4] << "=" << table[i-2][4] << "-" << "(" << table[i-1][2] << "*" << table[i-1][4] << endl;
-                // Repeat Steps 6-10 until RiC1 = 0
-                if (table[i][1] == 0) {
-                    s = table[i-1][3];
-                    t = table[i-1][4];
-                    cout << a << "(" << s  << ") + " << b << "(" << t << ") = " << gcd << endl;
-                    break;
-                }
-            }
+// Appends the m-bit binary representation of value, most significant coefficient first
+void appendBinary(string &out, uint64_t value, int m) {
+    for (int i=m-1; i>=0; i--) {
+        out += (char)('0' + ((value >> i) & 1));
+    }
+}
 
-            // Print out table to terminal
-            cout << "i r q s t" << endl;
-            for (int j=0; j<table.size();j++) {
-                for (int k=0; k<5; k++) {
-                    cout << table[j][k] << " ";
-                }
-                cout << endl;
+/*
+Reads "a op b" lines and writes one line per result in the calculator's format, e.g. 0101*0111=1000.
+Blank lines are skipped. Returns the number of lines that could not be computed.
+*/
+long long runBatch(GaloisField &field, istream &in, ostream &out) {
+    const fieldArithmetic &arithmetic = field.getArithmetic();
+    int m = field.getDegree();
+    uint64_t limit = elementLimit(m);
+    const size_t flushSize = 1 << 16;
+    string buffer;
+    buffer.reserve(flushSize + 256);
+    string line;
+    long long lineNumber = 0, errors = 0;
+    while (getline(in, line)) {
+        lineNumber++;
+        const char *p = line.c_str();
+        while (*p == ' ' || *p == '\t')
+            p++;
+        if (*p == '\0' || *p == '\r')
+            continue;
+        uint64_t a, b, result;
+        char op = 0;
+        bool divisionByZero = false;
+        bool valid = parseNumber(p, a);
+        if (valid) {
+            while (*p == ' ' || *p == '\t')
+                p++;
+            op = *p;
+            valid = (op != '\0' && strchr("+-*/^", op) != nullptr);
+            if (valid) {
+                p++;
+                valid = parseNumber(p, b);
             }
-            cout << endl;
-            
-
-            return vector<int> {s, t};
-        }
-
-        boost::dynamic_bitset <uint32_t> getValue () {
-            return value;
         }
-        void setValue (int newVal) {
-            value = boost::dynamic_bitset <uint32_t> (bitwidth, newVal);
+        if (valid) {
+            while (*p == ' ' || *p == '\t' || *p == '\r')
+                p++;
+            valid = (*p == '\0') && a <= limit && (b <= limit || op == '^');
+            divisionByZero = valid && op == '/' && b == 0;
+            valid = valid && compute(arithmetic, a, op, b, result);
         }
-        int getWidth () {
-            return bitwidth;
+        if (divisionByZero) {
+            cerr << "line " << lineNumber << ": division by zero\n";
+            errors++;
+            continue;
         }
-        void setWidth (int newSize) {
-            bitwidth = newSize;
+        if (!valid) {
+            cerr << "line " << lineNumber << ": expected \"a op b\" with elements of GF(2^" << m << ") and op one of +,-,*,/,^\n";
+            errors++;
+            continue;
         }
-
-
-        // The following functions are overloads of the +,-,*,/ operators such that they
-        // are performed according to their respective polynomial operations over the finite field
-
-        // Addition and subtraction in a binary extension field are identical to the bitwise XOR of the binary representations of the polynomials
-        boost::dynamic_bitset <uint32_t> operator + (fieldElement const &input) {
-            cout << input.value << "+" << value << "=" << (input.value ^ value) << endl;
-            return input.value ^ value;
+        appendBinary(buffer, a, m);
+        buffer += op;
+        if (op == '^') {
+            buffer += to_string(b); // an exponent, not an element
+        } else {
+            appendBinary(buffer, b, m);
         }
-        boost::dynamic_bitset <uint32_t> operator - (fieldElement const &input) {
-            cout << input.value << "-" << value << "=" << (input.value ^ value) << endl;
-            return input.value ^ value;
+        buffer += '=';
+        appendBinary(buffer, result, m);
+        buffer += '\n';
+        if (buffer.size() >= flushSize) {
+            out.write(buffer.data(), buffer.size());
+            buffer.clear();
         }
+    }
+    out.write(buffer.data(), buffer.size());
+    out.flush();
+    return errors;
+}
 
-        //Multiplication Operator that is currently working
-        boost::dynamic_bitset <uint32_t> operator * (fieldElement const &input) {
-
-            boost::dynamic_bitset <uint32_t> product(bitwidth, 0);
-            boost::dynamic_bitset <uint32_t> temp = value;
-            for (int i =0; i < bitwidth; i++) {
-                if (input.value[i])
-                    product = product ^ temp;
-                if(temp[bitwidth-1] == 1)
-                    temp = (temp << 1) ^ definingPolynomial;
-                else
-                    temp = (temp << 1);
+/*
+Binary records for test-vector generators: each input record is 17 bytes, the operator character followed by
+a and b as 8-byte little-endian integers, and each output is the 8-byte little-endian result. A record with
+an unknown operator, an out-of-range element or a division by zero produces all ones (never a valid element for m < 64). For ^ b is
+an exponent, any 64-bit value.
+Returns the number of such records.
+*/
+long long runBinaryBatch(GaloisField &field, istream &in, ostream &out) {
+    const fieldArithmetic &arithmetic = field.getArithmetic();
+    int m = field.getDegree();
+    uint64_t limit = elementLimit(m);
+    const size_t recordSize = 17, recordsPerBlock = 4096;
+    vector<unsigned char> input(recordSize * recordsPerBlock);
+    vector<unsigned char> output(8 * recordsPerBlock);
+    long long errors = 0;
+    while (in) {
+        in.read((char *)input.data(), input.size());
+        size_t records = in.gcount() / recordSize;
+        for (size_t r=0; r<records; r++) {
+            const unsigned char *record = &input[r * recordSize];
+            uint64_t a = 0, b = 0, result;
+            for (int i=7; i>=0; i--) {
+                a = (a << 8) | record[1 + i];
+                b = (b << 8) | record[9 + i];
             }
-            cout << value << "*" << input.value << "=" << product << endl;
-            return product;
-        }
-
-        //Division Operator NOT OPTIMIZED
-        boost::dynamic_bitset <uint32_t> operator / (fieldElement const &input) {
-            int inverses[] = {0,1,9,14,13,11,7,6,15,2,12,5,10,4,3,8};
-            int intval;
-            intval = (int) input.value.to_ulong();
-            boost::dynamic_bitset <uint32_t> temp(bitwidth, inverses[intval]);
-            boost::dynamic_bitset <uint32_t> quotient(bitwidth, 0);
-            for (int i =0; i < bitwidth; i++) {
-                if (value[i])
-                    quotient = quotient ^ temp;
-                if(temp[bitwidth-1] == 1)
-                    temp = (temp << 1) ^ definingPolynomial;
-                else
-                    temp = (temp << 1);
+            if (a > limit || (b > limit && record[0] != '^') || !compute(arithmetic, a, (char)record[0], b, result)) {
+                result = ~0ULL;
+                errors++;
             }
-            cout << value << "/" << input.value << "=" << quotient << endl;
-            return quotient;
-        }
-
-        fieldElement(int width, int val, int poly) {
-            // The preferred constructor; specifies both bitwidth and value of the element, and the defining polynomial of the field
-            bitwidth = width;
-            value = boost::dynamic_bitset <uint32_t> (bitwidth, val);
-            definingPolynomial = boost::dynamic_bitset <uint32_t> (bitwidth, poly);
-        }
-
-        fieldElement(int width, int val) {
-            // Specifies both bitwidth and value of the element
-            bitwidth = width;
-            value = boost::dynamic_bitset <uint32_t> (bitwidth, val);
-        }
-        fieldElement(int width) {
-            // If only one parameter is specified, assume its the bitwidth of the element representations
-            bitwidth = width;
-            value = boost::dynamic_bitset <uint32_t> (bitwidth, 0); // Default the value to 0 for now
-        }
-        fieldElement() {
-            // Default constructor; default to 4 bit values of 0
-            bitwidth = 4;
-            value = boost::dynamic_bitset <uint32_t> (bitwidth, 0);
-        }
-
-}; // end fieldElement class
-
-
-class GaloisField {
-
-private:
-    int degree = 3; // m where GaloisField(2^m)
-    int elementBitSize = degree; // number of bits needed to represent the polynomial elements
-    int polynomialVal = 19; // Defaults to defining polynomial of x^4+x+1 (10011)
-    vector<fieldElement> elements; // vector to hold field elements
-
-    // Create 2^(fieldSize) many binary representations of the polynomials
-    void defineFieldValues() {
-        for (int i=0; i<pow(2, elementBitSize); i++) {
-            fieldElement element_i(elementBitSize, i, polynomialVal);
-            elements.push_back(element_i);
-        }
-    }
-
-
-
-public:
-    // Move to private after testing
-    int polynomialStringToInt(string polynomial) {
-
-        // Note: Can possibly copy or modify the code at the bottom of this page: https://cplusplus.com/forum/general/118352/
-
-        /*
-            1. find all "x^"
-                a) also find just "x" without a "^", this is x^1s
-            2. find all chars on the left side of "x^"
-                *) This will be the coefficent of the term
-                *) Make sure it isn't an operator or whitespace or outside the bounds
-            3. find all chars on the right side of "x^"
-                *) This will be the power for each term
-            4. Mod 2 all coefficients (to keep it in binary extension field {0, 1})
-            5. Mod p(x) polynomial to keep it in range
-            6. Convert to binary representation (outside of this function or change the return type)
-        */
-
-
-        // Get index of every x
-        vector<int> xIndices;
-        vector<int> xCoefficients;
-        vector<int> xPowers;
-        cout << "x at ";
-        for (int i=0; i<polynomial.size(); i++) {
-            if (polynomial[i] == 'x') {
-                xIndices.push_back(i);
-                cout << i;
+            for (int i=0; i<8; i++) {
+                output[8*r + i] = (unsigned char)(result >> (8*i));
             }
         }
-        cout << endl;
-        for (auto it: xIndices) {
-            vector<char> blacklist = {'+', '-', '*', '/', ' '};
-            if (it == 0) {
-                // No leading coefficient on first term
-                xCoefficients.push_back(0);
-            } else {
-                if (find(blacklist.begin(), blacklist.end(), polynomial[it-1]) != blacklist.end()) {
-                    // If the char before x is not a number, its not a coefficient
-
-                    // Not sure if this is the most efficient way to do this, I'm open to scrapping this function entirely
-                }
-            }
+        out.write((const char *)output.data(), 8 * records);
+        if (in.gcount() % recordSize != 0) {
+            cerr << "input ends with a partial record\n";
+            errors++;
         }
-        return 0;
-    }
-
-    int getDegree() {
-        return degree;
-    }
-    void setDegree(int m){
-        degree = m;
-    }
-    int getElementBitSize() {
-        return elementBitSize;
-    }
-    void setElementBitSize(int s) {
-        elementBitSize = s;
     }
-    int getPolynomialVal() {
-        return polynomialVal;
-    }
-
-    vector<fieldElement> getElements() {
-        return elements;
-    }
-
+    out.flush();
+    return errors;
+}
 
-    // Overload the [] operator so that you can do GaloisField[0] to get the 0th fieldElement object
-    fieldElement& operator[] (int index) {
-        return elements[index];
+int batchMain(int argc, char *argv[]) {
+    uint64_t m, definingPolynomial;
+    const char *mArg = argc > 2 ? argv[2] : "", *polyArg = argc > 3 ? argv[3] : "";
+    if (argc < 4 || argc > 5 || !parseNumber(mArg, m) || *mArg || !parseNumber(polyArg, definingPolynomial) || *polyArg
+        || m < 1 || m > 64) {
+        cerr << "usage: " << argv[0] << " --batch|--batch-binary m poly [file]\n";
+        return 2;
     }
-
-    void binaryToPolynomial(boost::dynamic_bitset <uint32_t> bits) {
-        string lineOut = "";
-        if (bits == boost::dynamic_bitset <uint32_t>(elementBitSize, 0)) {
-            cout << "0" << endl;
-        } else {
-            for (int i=bits.size()-1; i>=0; i--) {
-                if (bits[i] == 1) {
-                    if (i == 0) {
-                        lineOut = lineOut + "1";
-                        //cout << "1"; // Anything to the 0th power is 1
-                    } else if (i == 1) {
-                        lineOut = lineOut + "x";
-                        //cout << "x";
-                    } else {
-                        lineOut = lineOut + "x^" + to_string(i);
-                        //cout << "x^" << i;
-                    }
-                if (i > 0) {
-                        lineOut = lineOut + " + ";
-                        //cout << " + ";
-                    }
-                }
-            }
-            // This part right here removes the trailing plus sign at the end of some lines
-            if (lineOut[lineOut.size()-2] == '+') {
-                cout << lineOut.substr(0,lineOut.size()-3);
-            } else {
-                cout << lineOut;
-            }
-
-            cout << endl;
-        }
+    ios::sync_with_stdio(false);
+    GaloisField field;
+    try {
+        field = GaloisField((int)m, definingPolynomial);
+    } catch (invalid_argument &e) {
+        cerr << e.what() << "\n";
+        return 2;
     }
-
-    void printFieldValues() {
-        for (int i=0; i<elements.size(); i++) {
-            cout << elements[i].getValue() << endl;
+    bool binary = strcmp(argv[1], "--batch-binary") == 0;
+    ifstream file;
+    if (argc == 5) {
+        file.open(argv[4], binary ? ios::binary : ios::in);
+        if (!file) {
+            cerr << "cannot open " << argv[4] << "\n";
+            return 2;
         }
     }
+    istream &in = (argc == 5) ? file : cin;
+    long long errors = binary ? runBinaryBatch(field, in, cout) : runBatch(field, in, cout);
+    return errors ? 1 : 0;
+}
 
-    /**
-     * Galois Field Class Constructor
-     *
-     * Define the Galois Field of a base of 2 with a degree m (i.e. GaloisField(2^m))
-     *
-     * @param m Degree of the polynomial of base 2
-     * @param poly Custom irreducible polynomial represented in decimal (i.e. 13 for x^3+2+1 [1101 which is 13])
-     */
-    GaloisField (int m, int poly) {
-        // If custom polynomial is desired, this constructor will be executed
-        degree = m;
-        elementBitSize = m;
-        polynomialVal = poly;
-        defineFieldValues();
-    }
 
-    // Default constructor
-    GaloisField () {
-        degree = 3;
-        polynomialVal = 13;
-        defineFieldValues();
+int main(int argc, char *argv[]) {
+    if (argc > 1 && (strcmp(argv[1], "--batch") == 0 || strcmp(argv[1], "--batch-binary") == 0)) {
+        return batchMain(argc, argv);
     }
 
-
-};
-
-/*
-// Temporary Main to test functionality
-int main() {
-    int m = 4;
-    int definingPolynomial = 19;
-    GaloisField field(4, 19);
-
-    fieldElement element0 = field[4];
-    fieldElement element1 = field[5];
-
-    //cout << element0.getValue() << endl;
-    //cout << element1.getValue() << endl;
-
-    element0.getBezoutCoefficients(element0, element1);
-}
-*/
-
-
-int main() {
     // GaloisField(2^4) defined by p(x) = x^4 + x + 1; p(x)=10011 which is 19
-    int m; // input m for degree of field GaloisField(2^m)
-    int maxin;  //holds value of maximum input value for given field
-    int definingPolynomial; //input polynomial
-    int a,b;  //variables for field elements
+    uint64_t m; // input m for degree of field GaloisField(2^m)
+    uint64_t maxin;  //holds value of maximum input value for given field
+    uint64_t definingPolynomial; //input polynomial
+    uint64_t a,b;  //variables for field elements
+    long long exponent; //for ^
     char cont = 'y'; //variable to continue
     char op;  //operation variable
-    cout << "Enter the given m for GF(2^m):";
-    cin >> m;
-    cout << "Enter the value of the given defining polynomial for GF(2^" << m << "):";
-    cin >> definingPolynomial;
-    GaloisField field(m, definingPolynomial);
-    maxin = (1 << m);
-    while(cont == 'y' || cont == 'Y'){
-        cout << "Enter the first element of the field:";
-        while(!(cin >> a) || a >= maxin){
-            cout << "Not a valid element of the field.\nEnter the first element of the field:";
-            cin.clear();
+    GaloisField field;
+    while (true) {
+        cout << "Enter the given m for GF(2^m):";
+        bool valid = readNumber(cin, m) && m >= 1 && m <= 64;
+        if (valid) {
+            cout << "Enter the value of the given defining polynomial for GF(2^" << m << "):";
+            valid = readNumber(cin, definingPolynomial);
+        }
+        if (!cin) {
+            return 1; // end of input
+        }
+        if (!valid) {
+            cout << "Not a valid field: m must be 1 to 64 and the polynomial a non-negative number.\n";
             cin.ignore(256,'\n');
+            continue;
+        }
+        try {
+            field = GaloisField((int)m, definingPolynomial);
+            break;
+        } catch (invalid_argument &e) {
+            cout << "Not a valid field: " << e.what() << ".\n";
         }
-        cout << "Enter the second element of the field:";
-        while(!(cin >> b) || b >= maxin){
+    }
+    field.setTrace(&cout); // the calculator shows each operation as e.g. 0101*0111=1000
+    maxin = elementLimit((int)m);
+    while(cont == 'y' || cont == 'Y'){
+        cout << "Enter the first element of the field:";
+        while(!readNumber(cin, a) || a > maxin){
+            if (!cin)
+                return 1;
             cout << "Not a valid element of the field.\nEnter the first element of the field:";
-            cin.clear();
             cin.ignore(256,'\n');
         }
         fieldElement elementa = field[a]; //create desired elements within the feild
-        fieldElement elementb = field[b];
-        cout << "Enter the operation to perform (+,-,*,/):";
+        cout << "Enter the operation to perform (+,-,*,/,^):";
         cin >> op;
-        while(op != '+' && op != '-' && op != '*' && op != '/'){
-            cout << "Not a valid operator. Enter the operation to perform (+,-,*,/):";
+        while(op != '+' && op != '-' && op != '*' && op != '/' && op != '^'){
+            if (!cin)
+                return 1;
+            cout << "Not a valid operator. Enter the operation to perform (+,-,*,/,^):";
             cin >> op;
         }
-        if(op == '+')
-            elementa + elementb;
-        else if(op == '-')
-            elementa - elementb;
-        else if(op == '/')
-            elementa / elementb;
-        else if(op == '*')
-            elementa * elementb;
+        if(op == '^'){ // the second input is an exponent, not an element; negative ones are powers of the inverse
+            cout << "Enter the exponent:";
+            while(!readExponent(cin, exponent)){
+                if (!cin)
+                    return 1;
+                cout << "Not a valid exponent.\nEnter the exponent:";
+                cin.ignore(256,'\n');
+            }
+            cout << field.elementToBinary(elementa) << "^" << exponent << "=" << field.elementToBinary(field.power(elementa, exponent)) << endl;
+        } else {
+            cout << "Enter the second element of the field:";
+            while(!readNumber(cin, b) || b > maxin){
+                if (!cin)
+                    return 1;
+                cout << "Not a valid element of the field.\nEnter the second element of the field:";
+                cin.ignore(256,'\n');
+            }
+            fieldElement elementb = field[b];
+            if(op == '+')
+                field.add(elementa, elementb);
+            else if(op == '-')
+                field.subtract(elementa, elementb);
+            else if(op == '/')
+                field.divide(elementa, elementb);
+            else if(op == '*')
+                field.multiply(elementa, elementb);
+        }
         cout << "Compute another? :";
         cin >> cont;
         cin.ignore(256,'\n');
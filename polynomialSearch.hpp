@@ -0,0 +1,215 @@
+#ifndef POLYNOMIAL_SEARCH_HPP
+#define POLYNOMIAL_SEARCH_HPP
+
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <functional>
+#include <algorithm>
+#include <stdexcept>
+#include "binaryPolynomial.hpp"
+
+/*
+    Finding defining polynomials. Sparse ones are preferred because reduction modulo
+    x^m + x^a + 1 or x^m + x^a + x^b + x^c + 1 is a few shifted XORs per word.
+*/
+
+// x^m + x^a + x^b + x^c + 1 with m > a > b > c > 0, or the trinomial x^m + x^a + 1 when b = c = 0
+struct lowWeightModulus {
+    int m;
+    int a;
+    int b;
+    int c;
+
+    bool isTrinomial() const {
+        return b == 0;
+    }
+    // Exponents of the terms below x^m, highest first
+    std::vector<int> terms() const {
+        return isTrinomial() ? std::vector<int>{a, 0} : std::vector<int>{a, b, c, 0};
+    }
+    // Multi-word polynomial, word i holding x^(64i) .. x^(64i+63)
+    std::vector<uint64_t> polynomial() const {
+        std::vector<uint64_t> f(m / 64 + 1, 0);
+        f[m / 64] |= 1ULL << (m % 64);
+        for (int k: terms()) {
+            f[k / 64] |= 1ULL << (k % 64);
+        }
+        return f;
+    }
+    // The polynomial without its x^m term, as GaloisField takes it; needs m <= 64
+    uint64_t reduction() const {
+        uint64_t r = 0;
+        for (int k: terms()) {
+            r |= 1ULL << k;
+        }
+        return r;
+    }
+};
+
+#include "lowWeightModuli.hpp"
+
+/**
+ * The first `limit` indices i < count (in increasing order) for which test(i) holds
+ *
+ * Workers pull candidate indices from a shared counter. Once `limit` hits are known, candidates beyond the
+ * last of them cannot change the answer, so the bound drops to it and the remaining work is cancelled. The
+ * result does not depend on the number of threads.
+ *
+ * @param threads Number of worker threads, 0 for one per hardware thread
+ */
+inline std::vector<size_t> parallelSearch(size_t count, const std::function<bool(size_t)> &test, size_t limit, unsigned threads = 0) {
+    if (limit == 0) {
+        return {};
+    }
+    if (threads == 0) {
+        threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    std::atomic<size_t> next(0), bound(count);
+    std::mutex hitsLock;
+    std::vector<size_t> hits;
+    auto worker = [&]() {
+        while (true) {
+            size_t i = next.fetch_add(1);
+            if (i >= bound.load()) {
+                return;
+            }
+            if (!test(i)) {
+                continue;
+            }
+            std::lock_guard<std::mutex> guard(hitsLock);
+            hits.insert(std::upper_bound(hits.begin(), hits.end(), i), i);
+            if (hits.size() >= limit) {
+                hits.resize(limit);
+                bound = hits.back() + 1;
+            }
+        }
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t=1; t<threads; t++) {
+        workers.emplace_back(worker);
+    }
+    worker();
+    for (auto &w: workers) {
+        w.join();
+    }
+    return hits;
+}
+
+/**
+ * Irreducible trinomials x^m + x^a + 1, smallest a first
+ *
+ * @param limit Stop after this many (the search is cancelled early)
+ */
+inline std::vector<lowWeightModulus> findTrinomials(int m, size_t limit = 1, unsigned threads = 0) {
+    std::vector<lowWeightModulus> found;
+    if (m < 2) {
+        return found;
+    }
+    auto candidate = [m](size_t i) { return lowWeightModulus{m, (int)i + 1, 0, 0}; };
+    for (size_t i: parallelSearch(m - 1, [&](size_t i) { return polynomialIsIrreducible(candidate(i).polynomial()); }, limit, threads)) {
+        found.push_back(candidate(i));
+    }
+    return found;
+}
+
+/**
+ * Irreducible pentanomials x^m + x^a + x^b + x^c + 1, ordered by a, then b, then c (the usual convention
+ * for standard tables, which keeps the reduction's shifts small)
+ */
+inline std::vector<lowWeightModulus> findPentanomials(int m, size_t limit = 1, unsigned threads = 0) {
+    std::vector<lowWeightModulus> found;
+    // Candidates are searched a block of `a` values at a time so small a is tried first without listing
+    // all O(m^3) triples up front
+    for (int aStart=3; aStart<m && found.size()<limit; aStart+=8) {
+        std::vector<lowWeightModulus> candidates;
+        for (int a=aStart; a<std::min(aStart + 8, m); a++) {
+            for (int b=2; b<a; b++) {
+                for (int c=1; c<b; c++) {
+                    candidates.push_back({m, a, b, c});
+                }
+            }
+        }
+        auto hits = parallelSearch(candidates.size(), [&](size_t i) { return polynomialIsIrreducible(candidates[i].polynomial()); }, limit - found.size(), threads);
+        for (size_t i: hits) {
+            found.push_back(candidates[i]);
+        }
+    }
+    return found;
+}
+
+/**
+ * Primitive defining polynomials for m <= 64, as GaloisField takes them (without the x^m term)
+ *
+ * Trinomials come first, then pentanomials, then the rest in increasing order. Primitivity needs the
+ * factors of 2^m - 1, which is why this stops at word-sized fields.
+ *
+ * @param isPrimitive Test for an irreducible candidate; fieldArithmetic(m, r, false).isPrimitive() fits
+ */
+inline std::vector<uint64_t> findPrimitive(int m, const std::function<bool(uint64_t)> &isPrimitive, size_t limit = 1, unsigned threads = 0) {
+    if (m < 1 || m > 64) {
+        throw std::invalid_argument("primitive polynomial search needs 1 <= m <= 64");
+    }
+    auto primitiveIrreducible = [&](uint64_t reduction) {
+        std::vector<uint64_t> f = {reduction | ((m < 64) ? 1ULL << m : 0), (m == 64) ? 1ULL : 0};
+        return polynomialIsIrreducible(f) && isPrimitive(reduction);
+    };
+    std::vector<uint64_t> found;
+    auto collect = [&](const std::vector<uint64_t> &candidates) {
+        auto hits = parallelSearch(candidates.size(), [&](size_t i) { return primitiveIrreducible(candidates[i]); }, limit - found.size(), threads);
+        for (size_t i: hits) {
+            found.push_back(candidates[i]);
+        }
+    };
+    std::vector<uint64_t> candidates;
+    for (int a=1; a<m; a++) {
+        candidates.push_back(lowWeightModulus{m, a, 0, 0}.reduction());
+    }
+    if (m == 1) {
+        candidates.push_back(1);
+    }
+    collect(candidates);
+    for (int a=3; a<m && found.size()<limit; a++) {
+        candidates.clear();
+        for (int b=2; b<a; b++) {
+            for (int c=1; c<b; c++) {
+                candidates.push_back(lowWeightModulus{m, a, b, c}.reduction());
+            }
+        }
+        collect(candidates);
+    }
+    // Dense candidates in blocks; a field of this size nearly always has a low-weight one, so this is rare
+    for (uint64_t start=1; found.size()<limit && m <= 32 && start < (1ULL << m); start+=(1 << 16)) {
+        candidates.clear();
+        for (uint64_t r=start; r<std::min<uint64_t>(start + (1 << 16), 1ULL << m); r+=2) {
+            int weight = __builtin_popcountll(r);
+            if (weight != 2 && weight != 4) {
+                candidates.push_back(r);
+            }
+        }
+        collect(candidates);
+    }
+    return found;
+}
+
+/**
+ * The cheapest defining polynomial to reduce by for GF(2^m): the trinomial with the smallest middle term,
+ * else the pentanomial with the smallest terms. Table lookup for m <= 1024, a search above that.
+ */
+inline lowWeightModulus fastestModulus(int m) {
+    if (m < 2) {
+        throw std::invalid_argument("fastestModulus needs m >= 2");
+    }
+    if (m < (int)(sizeof(lowWeightModuli) / sizeof(lowWeightModuli[0]))) {
+        const uint16_t *entry = lowWeightModuli[m];
+        return {m, entry[0], entry[1], entry[2]};
+    }
+    auto trinomials = findTrinomials(m);
+    if (!trinomials.empty()) {
+        return trinomials[0];
+    }
+    return findPentanomials(m)[0];
+}
+
+#endif // POLYNOMIAL_SEARCH_HPP
@@ -0,0 +1,128 @@
+#ifndef PRIME_FACTORS_HPP
+#define PRIME_FACTORS_HPP
+
+#include <cstdint>
+#include <vector>
+#include <algorithm>
+
+/*
+    Factoring 64-bit integers, for the order 2^m - 1 of the multiplicative group. Trial division would need
+    up to 2^32 steps (2^61 - 1 is prime), so this uses Miller-Rabin and Pollard's rho instead.
+*/
+
+inline uint64_t mulMod(uint64_t a, uint64_t b, uint64_t n) {
+    return (uint64_t)((unsigned __int128)a * b % n);
+}
+
+inline uint64_t powMod(uint64_t a, uint64_t exponent, uint64_t n) {
+    uint64_t result = 1 % n;
+    a %= n;
+    while (exponent > 0) {
+        if (exponent & 1)
+            result = mulMod(result, a, n);
+        a = mulMod(a, a, n);
+        exponent >>= 1;
+    }
+    return result;
+}
+
+// Deterministic for all 64-bit n with these bases
+inline bool isPrime(uint64_t n) {
+    if (n < 2) {
+        return false;
+    }
+    const uint64_t bases[] = {2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37};
+    for (uint64_t p: bases) {
+        if (n % p == 0) {
+            return n == p;
+        }
+    }
+    uint64_t d = n - 1;
+    int s = __builtin_ctzll(d);
+    d >>= s;
+    for (uint64_t a: bases) {
+        uint64_t x = powMod(a, d, n);
+        if (x == 1 || x == n - 1)
+            continue;
+        bool composite = true;
+        for (int r=1; r<s && composite; r++) {
+            x = mulMod(x, x, n);
+            composite = (x != n - 1);
+        }
+        if (composite) {
+            return false;
+        }
+    }
+    return true;
+}
+
+inline uint64_t gcdInteger(uint64_t a, uint64_t b) {
+    while (b) {
+        uint64_t t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+// A nontrivial factor of the odd composite n (Pollard's rho with Brent's cycle finding)
+inline uint64_t pollardRho(uint64_t n) {
+    for (uint64_t c=1; ; c++) {
+        uint64_t y = 2, x = 2, factor = 1, q = 1, ys = 2;
+        const uint64_t batch = 128; // gcd once per batch of differences
+        for (uint64_t r=1; factor == 1; r *= 2) {
+            x = y;
+            for (uint64_t i=0; i<r; i++)
+                y = (mulMod(y, y, n) + c) % n;
+            for (uint64_t k=0; k<r && factor == 1; k+=batch) {
+                ys = y;
+                for (uint64_t i=0; i<std::min(batch, r-k); i++) {
+                    y = (mulMod(y, y, n) + c) % n;
+                    q = mulMod(q, x > y ? x - y : y - x, n);
+                }
+                factor = gcdInteger(q, n);
+            }
+        }
+        if (factor == n) {
+            // The batch overshot; step back through it one difference at a time
+            do {
+                ys = (mulMod(ys, ys, n) + c) % n;
+                factor = gcdInteger(x > ys ? x - ys : ys - x, n);
+            } while (factor == 1);
+        }
+        if (factor != n) {
+            return factor;
+        }
+    }
+}
+
+// Distinct prime factors of n in increasing order
+inline std::vector<uint64_t> primeFactors(uint64_t n) {
+    std::vector<uint64_t> factors;
+    for (uint64_t p=2; p<100 && p*p<=n; p++) {
+        if (n % p == 0) {
+            factors.push_back(p);
+            while (n % p == 0)
+                n /= p;
+        }
+    }
+    std::vector<uint64_t> pending;
+    if (n > 1)
+        pending.push_back(n);
+    while (!pending.empty()) {
+        uint64_t m = pending.back();
+        pending.pop_back();
+        if (isPrime(m)) {
+            factors.push_back(m);
+            continue;
+        }
+        uint64_t d = pollardRho(m);
+        pending.push_back(d);
+        pending.push_back(m / d);
+    }
+    std::sort(factors.begin(), factors.end());
+    factors.erase(std::unique(factors.begin(), factors.end()), factors.end());
+    return factors;
+}
+
+#endif // PRIME_FACTORS_HPP
@@ -0,0 +1,537 @@
+#ifndef REGION_MULTIPLY_HPP
+#define REGION_MULTIPLY_HPP
+
+#include <cstdint>
+#include <cstddef>
+#include <type_traits>
+#include "cpuFeatures.hpp"
+#include "carrylessMultiply.hpp"
+
+/*
+    Bulk multiplication of a buffer of field elements by one constant: dst = c*src, or dst ^= c*src.
+
+    GF(2^8) (any m <= 8, one element per byte): multiplying by c is linear over GF(2), so
+    c*x = c*(x & 0x0F) ^ c*(x & 0xF0) and two 16-entry tables indexed by the nibbles of x give the product.
+    PSHUFB does 16/32/64 of those lookups at once. On GFNI CPUs the same linear map is an 8x8 bit matrix
+    applied by GF2P8AFFINEQB, which works for any defining polynomial (GF2P8MULB is fixed to 0x11B).
+
+    GF(2^16) and GF(2^32) (uint16_t/uint32_t words): the same idea with one table per nibble of the word
+    ("SPLIT w,4"). Each table entry is w bits wide, so it is stored as w/8 byte tables and the words are
+    transposed into byte planes in-register before the PSHUFB lookups. The scalar fallback uses one
+    256-entry table per byte ("SPLIT w,8"), and 32-bit words can also go through PCLMULQDQ.
+*/
+
+enum class regionKernel {
+    scalar,
+    ssse3,      // PSHUFB, 16 bytes
+    avx2,       // VPSHUFB, 32 bytes
+    avx512,     // VPSHUFB, 64 bytes (AVX-512BW)
+    gfniAvx2,   // GF2P8AFFINEQB, 32 bytes
+    gfniAvx512, // GF2P8AFFINEQB, 64 bytes
+    clmul       // PCLMULQDQ per element, 32-bit words only
+};
+
+// Everything the GF(2^8) kernels need to multiply by one constant
+struct gf8Multiplier {
+    uint8_t low[16];   // c * i
+    uint8_t high[16];  // c * (i << 4)
+    uint64_t affine;   // GF2P8AFFINEQB matrix of x -> c*x; byte 7-i holds output bit i
+};
+
+// multiply(a, b) is the field's product of two bytes and m <= 8 the field degree. Built from the m columns
+// c*x^j by linearity so that only valid elements are ever passed to multiply; input bits at or above m
+// contribute nothing.
+template <typename Multiply>
+gf8Multiplier makeGf8Multiplier(uint8_t c, int m, Multiply multiply) {
+    uint8_t column[8] = {};
+    for (int j=0; j<m && j<8; j++) {
+        column[j] = (uint8_t)multiply(c, (uint8_t)(1 << j));
+    }
+    gf8Multiplier table;
+    for (int i=0; i<16; i++) {
+        table.low[i] = 0;
+        table.high[i] = 0;
+        for (int j=0; j<4; j++) {
+            if ((i >> j) & 1) {
+                table.low[i] ^= column[j];
+                table.high[i] ^= column[j + 4];
+            }
+        }
+    }
+    table.affine = 0;
+    for (int j=0; j<8; j++) {
+        for (int i=0; i<8; i++) {
+            if ((column[j] >> i) & 1) {
+                table.affine |= 1ULL << (8 * (7 - i) + j);
+            }
+        }
+    }
+    return table;
+}
+
+// Fastest kernel this CPU supports
+inline regionKernel bestRegionKernel() {
+    const cpuFeatures &cpu = cpuFeatures::get();
+    if (cpu.gfni && cpu.avx512bw) {
+        return regionKernel::gfniAvx512;
+    }
+    if (cpu.gfni && cpu.avx2) {
+        return regionKernel::gfniAvx2;
+    }
+    if (cpu.avx512bw) {
+        return regionKernel::avx512;
+    }
+    if (cpu.avx2) {
+        return regionKernel::avx2;
+    }
+    if (cpu.ssse3) {
+        return regionKernel::ssse3;
+    }
+    return regionKernel::scalar;
+}
+
+// True if kernel can run on this CPU
+inline bool regionKernelSupported(regionKernel kernel) {
+    const cpuFeatures &cpu = cpuFeatures::get();
+    switch (kernel) {
+        case regionKernel::ssse3:
+            return cpu.ssse3;
+        case regionKernel::avx2:
+            return cpu.avx2;
+        case regionKernel::avx512:
+            return cpu.avx512bw;
+        case regionKernel::gfniAvx2:
+            return cpu.gfni && cpu.avx2;
+        case regionKernel::gfniAvx512:
+            return cpu.gfni && cpu.avx512bw;
+        case regionKernel::clmul:
+            return cpu.pclmul;
+        default:
+            return true;
+    }
+}
+
+template <bool Accumulate>
+inline void regionMultiply8Scalar(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c) {
+    if (n >= 1024) {
+        // Long buffers amortize expanding the nibble tables to one lookup per byte
+        uint8_t full[256];
+        for (int x=0; x<256; x++) {
+            full[x] = c.low[x & 0x0F] ^ c.high[x >> 4];
+        }
+        for (size_t i=0; i<n; i++) {
+            dst[i] = Accumulate ? (uint8_t)(dst[i] ^ full[src[i]]) : full[src[i]];
+        }
+        return;
+    }
+    for (size_t i=0; i<n; i++) {
+        uint8_t product = c.low[src[i] & 0x0F] ^ c.high[src[i] >> 4];
+        dst[i] = Accumulate ? (uint8_t)(dst[i] ^ product) : product;
+    }
+}
+
+#if GALOIS_X86
+template <bool Accumulate>
+__attribute__((target("ssse3")))
+void regionMultiply8Ssse3(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c) {
+    const __m128i low = _mm_loadu_si128((const __m128i*)c.low);
+    const __m128i high = _mm_loadu_si128((const __m128i*)c.high);
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i+16<=n; i+=16) {
+        __m128i x = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i product = _mm_xor_si128(_mm_shuffle_epi8(low, _mm_and_si128(x, nibble)),
+                                        _mm_shuffle_epi8(high, _mm_and_si128(_mm_srli_epi64(x, 4), nibble)));
+        if (Accumulate) {
+            product = _mm_xor_si128(product, _mm_loadu_si128((const __m128i*)(dst + i)));
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), product);
+    }
+    regionMultiply8Scalar<Accumulate>(src + i, dst + i, n - i, c);
+}
+
+template <bool Accumulate>
+__attribute__((target("avx2")))
+void regionMultiply8Avx2(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c) {
+    const __m256i low = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)c.low));
+    const __m256i high = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)c.high));
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i+32<=n; i+=32) {
+        __m256i x = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i product = _mm256_xor_si256(_mm256_shuffle_epi8(low, _mm256_and_si256(x, nibble)),
+                                           _mm256_shuffle_epi8(high, _mm256_and_si256(_mm256_srli_epi64(x, 4), nibble)));
+        if (Accumulate) {
+            product = _mm256_xor_si256(product, _mm256_loadu_si256((const __m256i*)(dst + i)));
+        }
+        _mm256_storeu_si256((__m256i*)(dst + i), product);
+    }
+    regionMultiply8Scalar<Accumulate>(src + i, dst + i, n - i, c);
+}
+
+template <bool Accumulate>
+__attribute__((target("avx512f,avx512bw")))
+void regionMultiply8Avx512(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c) {
+    const __m512i low = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)c.low));
+    const __m512i high = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i*)c.high));
+    const __m512i nibble = _mm512_set1_epi8(0x0F);
+    size_t i = 0;
+    for (; i+64<=n; i+=64) {
+        __m512i x = _mm512_loadu_si512((const void*)(src + i));
+        __m512i product = _mm512_xor_si512(_mm512_shuffle_epi8(low, _mm512_and_si512(x, nibble)),
+                                           _mm512_shuffle_epi8(high, _mm512_and_si512(_mm512_srli_epi64(x, 4), nibble)));
+        if (Accumulate) {
+            product = _mm512_xor_si512(product, _mm512_loadu_si512((const void*)(dst + i)));
+        }
+        _mm512_storeu_si512((void*)(dst + i), product);
+    }
+    regionMultiply8Scalar<Accumulate>(src + i, dst + i, n - i, c);
+}
+
+template <bool Accumulate>
+__attribute__((target("gfni,avx2")))
+void regionMultiply8GfniAvx2(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c) {
+    const __m256i matrix = _mm256_set1_epi64x((long long)c.affine);
+    size_t i = 0;
+    for (; i+32<=n; i+=32) {
+        __m256i product = _mm256_gf2p8affine_epi64_epi8(_mm256_loadu_si256((const __m256i*)(src + i)), matrix, 0);
+        if (Accumulate) {
+            product = _mm256_xor_si256(product, _mm256_loadu_si256((const __m256i*)(dst + i)));
+        }
+        _mm256_storeu_si256((__m256i*)(dst + i), product);
+    }
+    regionMultiply8Scalar<Accumulate>(src + i, dst + i, n - i, c);
+}
+
+template <bool Accumulate>
+__attribute__((target("gfni,avx512f,avx512bw")))
+void regionMultiply8GfniAvx512(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c) {
+    const __m512i matrix = _mm512_set1_epi64((long long)c.affine);
+    size_t i = 0;
+    for (; i+64<=n; i+=64) {
+        __m512i product = _mm512_gf2p8affine_epi64_epi8(_mm512_loadu_si512((const void*)(src + i)), matrix, 0);
+        if (Accumulate) {
+            product = _mm512_xor_si512(product, _mm512_loadu_si512((const void*)(dst + i)));
+        }
+        _mm512_storeu_si512((void*)(dst + i), product);
+    }
+    regionMultiply8Scalar<Accumulate>(src + i, dst + i, n - i, c);
+}
+#endif
+
+// dst = c*src (or dst ^= c*src when Accumulate) over n bytes; src and dst may be the same buffer
+template <bool Accumulate>
+void regionMultiply8(const uint8_t *src, uint8_t *dst, size_t n, const gf8Multiplier &c, regionKernel kernel) {
+    switch (kernel) {
+#if GALOIS_X86
+        case regionKernel::ssse3:
+            return regionMultiply8Ssse3<Accumulate>(src, dst, n, c);
+        case regionKernel::avx2:
+            return regionMultiply8Avx2<Accumulate>(src, dst, n, c);
+        case regionKernel::avx512:
+            return regionMultiply8Avx512<Accumulate>(src, dst, n, c);
+        case regionKernel::gfniAvx2:
+            return regionMultiply8GfniAvx2<Accumulate>(src, dst, n, c);
+        case regionKernel::gfniAvx512:
+            return regionMultiply8GfniAvx512<Accumulate>(src, dst, n, c);
+#endif
+        default:
+            return regionMultiply8Scalar<Accumulate>(src, dst, n, c);
+    }
+}
+
+
+// Everything the 16 and 32-bit kernels need to multiply by one constant
+template <typename Word>
+struct wideMultiplier {
+    static const int bytes = sizeof(Word);
+    static const int nibbles = 2 * sizeof(Word);
+    uint8_t split4[nibbles][bytes][16]; // byte b of c * (i << 4k), for the PSHUFB kernels
+    Word split8[bytes][256];            // c * (i << 8k), for the scalar kernel
+    // Barrett parameters for the PCLMULQDQ kernel (see carrylessMultiply.hpp)
+    uint64_t c;
+    int m;
+    uint64_t mask;
+    uint64_t reduction;
+    uint64_t barrettMu;
+};
+
+// As makeGf8Multiplier: built from the m columns c*x^j, so multiply only ever sees valid elements
+template <typename Word, typename Multiply>
+void makeWideMultiplier(wideMultiplier<Word> &table, Word c, int m, uint64_t reduction, Multiply multiply) {
+    const int bits = 8 * sizeof(Word);
+    Word column[bits] = {};
+    for (int j=0; j<m && j<bits; j++) {
+        column[j] = (Word)multiply(c, (Word)((Word)1 << j));
+    }
+    for (int k=0; k<table.bytes; k++) {
+        // Entry i is entry i without its lowest set bit plus that bit's column
+        table.split8[k][0] = 0;
+        for (int i=1; i<256; i++) {
+            int lowest = __builtin_ctz(i);
+            table.split8[k][i] = table.split8[k][i & (i - 1)] ^ column[8*k + lowest];
+        }
+    }
+    for (int k=0; k<table.nibbles; k++) {
+        for (int i=0; i<16; i++) {
+            // The low nibble of byte k/2 is i, or the high nibble is i
+            Word product = table.split8[k / 2][(k % 2) ? (i << 4) : i];
+            for (int b=0; b<table.bytes; b++) {
+                table.split4[k][b][i] = (uint8_t)(product >> (8 * b));
+            }
+        }
+    }
+    table.c = c;
+    table.m = m;
+    table.mask = (m >= 64) ? ~0ULL : ((1ULL << m) - 1);
+    table.reduction = reduction & table.mask;
+    table.barrettMu = barrettConstant(m, table.reduction);
+}
+
+template <typename Word, bool Accumulate>
+inline void regionMultiplyWideScalar(const Word *src, Word *dst, size_t n, const wideMultiplier<Word> &c) {
+    for (size_t i=0; i<n; i++) {
+        Word x = src[i];
+        Word product = 0;
+        for (int k=0; k<c.bytes; k++) {
+            product ^= c.split8[k][(x >> (8 * k)) & 0xFF];
+        }
+        dst[i] = Accumulate ? (Word)(dst[i] ^ product) : product;
+    }
+}
+
+#if GALOIS_X86
+/*
+    16-bit words, 16 per iteration: PACKUSWB splits the low and high bytes of two vectors into byte planes,
+    each plane gives two nibble indices, and PUNPCKLBW/PUNPCKHBW put the product bytes back in word order.
+*/
+template <bool Accumulate>
+__attribute__((target("ssse3")))
+void regionMultiply16Ssse3(const uint16_t *src, uint16_t *dst, size_t n, const wideMultiplier<uint16_t> &c) {
+    __m128i table[4][2];
+    for (int k=0; k<4; k++) {
+        for (int b=0; b<2; b++) {
+            table[k][b] = _mm_loadu_si128((const __m128i*)c.split4[k][b]);
+        }
+    }
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i lowByte = _mm_set1_epi16(0x00FF);
+    size_t i = 0;
+    for (; i+16<=n; i+=16) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(src + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(src + i + 8));
+        __m128i low = _mm_packus_epi16(_mm_and_si128(a, lowByte), _mm_and_si128(b, lowByte));
+        __m128i high = _mm_packus_epi16(_mm_srli_epi16(a, 8), _mm_srli_epi16(b, 8));
+        __m128i index[4] = {
+            _mm_and_si128(low, nibble), _mm_and_si128(_mm_srli_epi64(low, 4), nibble),
+            _mm_and_si128(high, nibble), _mm_and_si128(_mm_srli_epi64(high, 4), nibble)
+        };
+        __m128i productLow = _mm_setzero_si128(), productHigh = _mm_setzero_si128();
+        for (int k=0; k<4; k++) {
+            productLow = _mm_xor_si128(productLow, _mm_shuffle_epi8(table[k][0], index[k]));
+            productHigh = _mm_xor_si128(productHigh, _mm_shuffle_epi8(table[k][1], index[k]));
+        }
+        a = _mm_unpacklo_epi8(productLow, productHigh);
+        b = _mm_unpackhi_epi8(productLow, productHigh);
+        if (Accumulate) {
+            a = _mm_xor_si128(a, _mm_loadu_si128((const __m128i*)(dst + i)));
+            b = _mm_xor_si128(b, _mm_loadu_si128((const __m128i*)(dst + i + 8)));
+        }
+        _mm_storeu_si128((__m128i*)(dst + i), a);
+        _mm_storeu_si128((__m128i*)(dst + i + 8), b);
+    }
+    regionMultiplyWideScalar<uint16_t, Accumulate>(src + i, dst + i, n - i, c);
+}
+
+// As regionMultiply16Ssse3; every step stays within a 128-bit lane, so the same sequence works on AVX2
+template <bool Accumulate>
+__attribute__((target("avx2")))
+void regionMultiply16Avx2(const uint16_t *src, uint16_t *dst, size_t n, const wideMultiplier<uint16_t> &c) {
+    __m256i table[4][2];
+    for (int k=0; k<4; k++) {
+        for (int b=0; b<2; b++) {
+            table[k][b] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)c.split4[k][b]));
+        }
+    }
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i lowByte = _mm256_set1_epi16(0x00FF);
+    size_t i = 0;
+    for (; i+32<=n; i+=32) {
+        __m256i a = _mm256_loadu_si256((const __m256i*)(src + i));
+        __m256i b = _mm256_loadu_si256((const __m256i*)(src + i + 16));
+        __m256i low = _mm256_packus_epi16(_mm256_and_si256(a, lowByte), _mm256_and_si256(b, lowByte));
+        __m256i high = _mm256_packus_epi16(_mm256_srli_epi16(a, 8), _mm256_srli_epi16(b, 8));
+        __m256i index[4] = {
+            _mm256_and_si256(low, nibble), _mm256_and_si256(_mm256_srli_epi64(low, 4), nibble),
+            _mm256_and_si256(high, nibble), _mm256_and_si256(_mm256_srli_epi64(high, 4), nibble)
+        };
+        __m256i productLow = _mm256_setzero_si256(), productHigh = _mm256_setzero_si256();
+        for (int k=0; k<4; k++) {
+            productLow = _mm256_xor_si256(productLow, _mm256_shuffle_epi8(table[k][0], index[k]));
+            productHigh = _mm256_xor_si256(productHigh, _mm256_shuffle_epi8(table[k][1], index[k]));
+        }
+        a = _mm256_unpacklo_epi8(productLow, productHigh);
+        b = _mm256_unpackhi_epi8(productLow, productHigh);
+        if (Accumulate) {
+            a = _mm256_xor_si256(a, _mm256_loadu_si256((const __m256i*)(dst + i)));
+            b = _mm256_xor_si256(b, _mm256_loadu_si256((const __m256i*)(dst + i + 16)));
+        }
+        _mm256_storeu_si256((__m256i*)(dst + i), a);
+        _mm256_storeu_si256((__m256i*)(dst + i + 16), b);
+    }
+    regionMultiplyWideScalar<uint16_t, Accumulate>(src + i, dst + i, n - i, c);
+}
+
+/*
+    32-bit words, 16 per iteration: PSHUFB gathers byte j of the four words of each vector into dword j,
+    and a 4x4 dword transpose then leaves byte plane j in vector j. Both steps are their own inverse, so
+    the product planes go back to word order the same way.
+*/
+template <bool Accumulate>
+__attribute__((target("ssse3")))
+void regionMultiply32Ssse3(const uint32_t *src, uint32_t *dst, size_t n, const wideMultiplier<uint32_t> &c) {
+    const __m128i nibble = _mm_set1_epi8(0x0F);
+    const __m128i byteTranspose = _mm_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    size_t i = 0;
+    for (; i+16<=n; i+=16) {
+        __m128i v[4];
+        for (int j=0; j<4; j++) {
+            v[j] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)(src + i + 4*j)), byteTranspose);
+        }
+        __m128i t0 = _mm_unpacklo_epi32(v[0], v[1]), t1 = _mm_unpacklo_epi32(v[2], v[3]);
+        __m128i t2 = _mm_unpackhi_epi32(v[0], v[1]), t3 = _mm_unpackhi_epi32(v[2], v[3]);
+        __m128i plane[4] = {_mm_unpacklo_epi64(t0, t1), _mm_unpackhi_epi64(t0, t1), _mm_unpacklo_epi64(t2, t3), _mm_unpackhi_epi64(t2, t3)};
+
+        __m128i product[4] = {_mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128(), _mm_setzero_si128()};
+        for (int k=0; k<8; k++) {
+            __m128i index = (k % 2) ? _mm_and_si128(_mm_srli_epi64(plane[k / 2], 4), nibble) : _mm_and_si128(plane[k / 2], nibble);
+            for (int b=0; b<4; b++) {
+                product[b] = _mm_xor_si128(product[b], _mm_shuffle_epi8(_mm_loadu_si128((const __m128i*)c.split4[k][b]), index));
+            }
+        }
+
+        t0 = _mm_unpacklo_epi32(product[0], product[1]);
+        t1 = _mm_unpacklo_epi32(product[2], product[3]);
+        t2 = _mm_unpackhi_epi32(product[0], product[1]);
+        t3 = _mm_unpackhi_epi32(product[2], product[3]);
+        v[0] = _mm_unpacklo_epi64(t0, t1);
+        v[1] = _mm_unpackhi_epi64(t0, t1);
+        v[2] = _mm_unpacklo_epi64(t2, t3);
+        v[3] = _mm_unpackhi_epi64(t2, t3);
+        for (int j=0; j<4; j++) {
+            __m128i words = _mm_shuffle_epi8(v[j], byteTranspose);
+            if (Accumulate) {
+                words = _mm_xor_si128(words, _mm_loadu_si128((const __m128i*)(dst + i + 4*j)));
+            }
+            _mm_storeu_si128((__m128i*)(dst + i + 4*j), words);
+        }
+    }
+    regionMultiplyWideScalar<uint32_t, Accumulate>(src + i, dst + i, n - i, c);
+}
+
+// As regionMultiply32Ssse3, lane by lane on AVX2
+template <bool Accumulate>
+__attribute__((target("avx2")))
+void regionMultiply32Avx2(const uint32_t *src, uint32_t *dst, size_t n, const wideMultiplier<uint32_t> &c) {
+    __m256i table[8][4];
+    for (int k=0; k<8; k++) {
+        for (int b=0; b<4; b++) {
+            table[k][b] = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i*)c.split4[k][b]));
+        }
+    }
+    const __m256i nibble = _mm256_set1_epi8(0x0F);
+    const __m256i byteTranspose = _mm256_setr_epi8(0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15,
+                                                   0, 4, 8, 12, 1, 5, 9, 13, 2, 6, 10, 14, 3, 7, 11, 15);
+    size_t i = 0;
+    for (; i+32<=n; i+=32) {
+        __m256i v[4];
+        for (int j=0; j<4; j++) {
+            v[j] = _mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i*)(src + i + 8*j)), byteTranspose);
+        }
+        __m256i t0 = _mm256_unpacklo_epi32(v[0], v[1]), t1 = _mm256_unpacklo_epi32(v[2], v[3]);
+        __m256i t2 = _mm256_unpackhi_epi32(v[0], v[1]), t3 = _mm256_unpackhi_epi32(v[2], v[3]);
+        __m256i plane[4] = {_mm256_unpacklo_epi64(t0, t1), _mm256_unpackhi_epi64(t0, t1), _mm256_unpacklo_epi64(t2, t3), _mm256_unpackhi_epi64(t2, t3)};
+
+        __m256i product[4] = {_mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256(), _mm256_setzero_si256()};
+        for (int k=0; k<8; k++) {
+            __m256i index = (k % 2) ? _mm256_and_si256(_mm256_srli_epi64(plane[k / 2], 4), nibble) : _mm256_and_si256(plane[k / 2], nibble);
+            for (int b=0; b<4; b++) {
+                product[b] = _mm256_xor_si256(product[b], _mm256_shuffle_epi8(table[k][b], index));
+            }
+        }
+
+        t0 = _mm256_unpacklo_epi32(product[0], product[1]);
+        t1 = _mm256_unpacklo_epi32(product[2], product[3]);
+        t2 = _mm256_unpackhi_epi32(product[0], product[1]);
+        t3 = _mm256_unpackhi_epi32(product[2], product[3]);
+        v[0] = _mm256_unpacklo_epi64(t0, t1);
+        v[1] = _mm256_unpackhi_epi64(t0, t1);
+        v[2] = _mm256_unpacklo_epi64(t2, t3);
+        v[3] = _mm256_unpackhi_epi64(t2, t3);
+        for (int j=0; j<4; j++) {
+            __m256i words = _mm256_shuffle_epi8(v[j], byteTranspose);
+            if (Accumulate) {
+                words = _mm256_xor_si256(words, _mm256_loadu_si256((const __m256i*)(dst + i + 8*j)));
+            }
+            _mm256_storeu_si256((__m256i*)(dst + i + 8*j), words);
+        }
+    }
+    regionMultiplyWideScalar<uint32_t, Accumulate>(src + i, dst + i, n - i, c);
+}
+
+// 32-bit words through PCLMULQDQ and Barrett reduction, one element at a time. With m <= 32 every product
+// fits in 64 bits, so the whole reduction stays in XMM registers and consecutive elements overlap
+template <bool Accumulate>
+__attribute__((target("pclmul,sse2")))
+void regionMultiply32Clmul(const uint32_t *src, uint32_t *dst, size_t n, const wideMultiplier<uint32_t> &c) {
+    const __m128i constant = _mm_cvtsi64_si128((long long)c.c);
+    const __m128i mu = _mm_cvtsi64_si128((long long)c.barrettMu);
+    const __m128i reduction = _mm_cvtsi64_si128((long long)c.reduction);
+    const __m128i shift = _mm_cvtsi32_si128(c.m);
+    const uint32_t mask = (uint32_t)c.mask;
+    for (size_t i=0; i<n; i++) {
+        __m128i product = _mm_clmulepi64_si128(constant, _mm_cvtsi32_si128((int)src[i]), 0x00);
+        __m128i high = _mm_srl_epi64(product, shift);
+        __m128i q = _mm_xor_si128(high, _mm_srl_epi64(_mm_clmulepi64_si128(high, mu, 0x00), shift));
+        uint32_t remainder = (uint32_t)_mm_cvtsi128_si32(_mm_xor_si128(product, _mm_clmulepi64_si128(q, reduction, 0x00))) & mask;
+        dst[i] = Accumulate ? (dst[i] ^ remainder) : remainder;
+    }
+}
+#endif
+
+// dst = c*src (or dst ^= c*src) over n 16 or 32-bit words; the 8-bit kernel choices map to the widest
+// wide-word kernel the CPU has, and clmul only applies to 32-bit words
+template <bool Accumulate>
+void regionMultiplyWide(const uint16_t *src, uint16_t *dst, size_t n, const wideMultiplier<uint16_t> &c, regionKernel kernel) {
+#if GALOIS_X86
+    if (kernel != regionKernel::scalar && kernel != regionKernel::ssse3 && cpuFeatures::get().avx2) {
+        return regionMultiply16Avx2<Accumulate>(src, dst, n, c);
+    }
+    if (kernel != regionKernel::scalar && cpuFeatures::get().ssse3) {
+        return regionMultiply16Ssse3<Accumulate>(src, dst, n, c);
+    }
+#endif
+    regionMultiplyWideScalar<uint16_t, Accumulate>(src, dst, n, c);
+}
+
+template <bool Accumulate>
+void regionMultiplyWide(const uint32_t *src, uint32_t *dst, size_t n, const wideMultiplier<uint32_t> &c, regionKernel kernel) {
+#if GALOIS_X86
+    if (kernel == regionKernel::clmul && cpuFeatures::get().pclmul) {
+        return regionMultiply32Clmul<Accumulate>(src, dst, n, c);
+    }
+    if (kernel != regionKernel::scalar && kernel != regionKernel::ssse3 && cpuFeatures::get().avx2) {
+        return regionMultiply32Avx2<Accumulate>(src, dst, n, c);
+    }
+    if (kernel != regionKernel::scalar && cpuFeatures::get().ssse3) {
+        return regionMultiply32Ssse3<Accumulate>(src, dst, n, c);
+    }
+#endif
+    regionMultiplyWideScalar<uint32_t, Accumulate>(src, dst, n, c);
+}
+
+// The multiplier tables for a buffer of Words: gf8Multiplier for bytes, wideMultiplier for 16 and 32-bit words
+template <typename Word>
+using regionMultiplier = typename std::conditional<sizeof(Word) == 1, gf8Multiplier, wideMultiplier<Word>>::type;
+
+#endif // REGION_MULTIPLY_HPP